@@ -39,11 +39,22 @@ typedef struct _pngle_t pngle_t;
 typedef void (*pngle_init_callback_t)(pngle_t* pngle, uint32_t w, uint32_t h);
 typedef void (*pngle_draw_callback_t)(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]);
 typedef void (*pngle_done_callback_t)(pngle_t* pngle);
+// called with (possibly partial) data of chunks unknown to pngle (eg. tEXt), before their CRC is checked
+typedef void (*pngle_chunk_callback_t)(
+  pngle_t* pngle, uint32_t type, const uint8_t* data, size_t len, uint32_t offset, uint32_t chunk_len);
+
+// Memory of pngle object and its buffers (~44 KB with inflator and dictionary), calloc has to return zeroed memory
+typedef struct _pngle_allocator_t {
+  void* (*calloc)(void* user_data, size_t n, size_t size);
+  void (*free)(void* user_data, void* p);
+  void* user_data;
+} pngle_allocator_t;
 
 // ----------------
 // Basic interfaces
 // ----------------
 pngle_t* pngle_new();
+pngle_t* pngle_new_with_allocator(const pngle_allocator_t* allocator); // NULL for calloc / free
 void pngle_destroy(pngle_t* pngle);
 void pngle_reset(pngle_t* pngle); // clear its internal state (not applied to pngle_set_* functions)
 const char* pngle_error(pngle_t* pngle);
@@ -56,14 +67,22 @@ uint32_t pngle_get_height(pngle_t* pngle);
 void pngle_set_init_callback(pngle_t* png, pngle_init_callback_t callback);
 void pngle_set_draw_callback(pngle_t* png, pngle_draw_callback_t callback);
 void pngle_set_done_callback(pngle_t* png, pngle_done_callback_t callback);
+void pngle_set_chunk_callback(pngle_t* png, pngle_chunk_callback_t callback);
 
 void pngle_set_display_gamma(
   pngle_t* pngle, double display_gamma); // enables gamma correction by specifying display gamma, typically 2.2. No
                                          // effect when gAMA chunk is missing
 
+// decodes only the rectangle of the image (clipped to it), as if the image was cropped: init callback gets viewport
+// size and draw callback coordinates relative to it. Rows above the viewport are unfiltered only and rows below
+// inflated only. Set before the first pngle_feed(), w or h 0 to draw whole image
+void pngle_set_viewport(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h);
+
 void pngle_set_user_data(pngle_t* pngle, void* user_data);
 void* pngle_get_user_data(pngle_t* pngle);
 
+const char* pngle_get_inflate_backend_name(); // name of inflate backend selected at build time
+
 // ----------------
 // Debug interfaces
 // ----------------
@@ -0,0 +1,47 @@
+// Bundled miniz tinfl inflate backend
+//
+// Also used by PNGLE_INFLATE_MINIZ_IRAM config, where linker.lf places tinfl_decompress() into IRAM
+
+#include "miniz.h"
+#include "pngle_inflate.h"
+
+#if __has_include(<sdkconfig.h>)
+#include <sdkconfig.h>
+#endif
+
+_Static_assert(TINFL_LZ_DICT_SIZE == PNGLE_INFLATE_DICT_SIZE, "Unexpected tinfl dictionary size");
+
+static void miniz_init(void* state) {
+  tinfl_decompressor* inflator = (tinfl_decompressor*)state;
+  tinfl_init(inflator);
+}
+
+static pngle_inflate_status_t miniz_decompress(
+  void* state, const uint8_t* in, size_t* in_bytes, uint8_t* dict, uint8_t* next_out, size_t* out_bytes) {
+  tinfl_status status = tinfl_decompress((tinfl_decompressor*)state,
+    (const mz_uint8*)in,
+    in_bytes,
+    (mz_uint8*)dict,
+    (mz_uint8*)next_out,
+    out_bytes,
+    TINFL_FLAG_HAS_MORE_INPUT | TINFL_FLAG_PARSE_ZLIB_HEADER);
+
+  if (status < TINFL_STATUS_DONE) return PNGLE_INFLATE_FAILED;
+  return (pngle_inflate_status_t)status;
+}
+
+static uint32_t miniz_crc32(uint32_t crc, const uint8_t* buf, size_t len) {
+  return (uint32_t)mz_crc32(crc, (const mz_uint8*)buf, len);
+}
+
+const pngle_inflate_backend_t pngle_inflate_backend = {
+#ifdef CONFIG_PNGLE_INFLATE_MINIZ_IRAM
+  .name = "miniz-iram",
+#else
+  .name = "miniz",
+#endif
+  .state_size = sizeof(tinfl_decompressor),
+  .init = miniz_init,
+  .decompress = miniz_decompress,
+  .crc32 = miniz_crc32,
+};
@@ -0,0 +1,42 @@
+// ESP32 mask ROM tinfl inflate backend
+//
+// ROM contains miniz v1.x tinfl_decompress() (same coroutine API as the bundled one), so the bundled miniz
+// doesn't have to be linked at all. CRC is computed by ROM as well.
+
+#include "esp32/rom/miniz.h"
+#include "esp_rom_crc.h"
+#include "pngle_inflate.h"
+
+_Static_assert(TINFL_LZ_DICT_SIZE == PNGLE_INFLATE_DICT_SIZE, "Unexpected tinfl dictionary size");
+
+static void rom_init(void* state) {
+  tinfl_decompressor* inflator = (tinfl_decompressor*)state;
+  tinfl_init(inflator);
+}
+
+static pngle_inflate_status_t rom_decompress(
+  void* state, const uint8_t* in, size_t* in_bytes, uint8_t* dict, uint8_t* next_out, size_t* out_bytes) {
+  tinfl_status status = tinfl_decompress((tinfl_decompressor*)state,
+    (const mz_uint8*)in,
+    in_bytes,
+    (mz_uint8*)dict,
+    (mz_uint8*)next_out,
+    out_bytes,
+    TINFL_FLAG_HAS_MORE_INPUT | TINFL_FLAG_PARSE_ZLIB_HEADER);
+
+  if (status < TINFL_STATUS_DONE) return PNGLE_INFLATE_FAILED;
+  return (pngle_inflate_status_t)status;
+}
+
+static uint32_t rom_crc32(uint32_t crc, const uint8_t* buf, size_t len) {
+  // NOTE ROM crc32_le does the zlib pre/post inversion itself, so it can be chained as mz_crc32()
+  return esp_rom_crc32_le(crc, buf, len);
+}
+
+const pngle_inflate_backend_t pngle_inflate_backend = {
+  .name = "rom",
+  .state_size = sizeof(tinfl_decompressor),
+  .init = rom_init,
+  .decompress = rom_decompress,
+  .crc32 = rom_crc32,
+};
@@ -24,7 +24,7 @@
 
 #include "pngle/pngle.h"
 
-#include "miniz.h"
+#include "pngle_inflate.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -35,6 +35,9 @@
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
+#ifndef MAX
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
 
 #ifdef PNGLE_DEBUG
 #define debug_printf(...) fprintf(stderr, __VA_ARGS__)
@@ -45,7 +48,8 @@
 #define PNGLE_ERROR(s) (pngle->error = (s), pngle->state = PNGLE_STATE_ERROR, -1)
 #define PNGLE_CALLOC(a, b, name) \
   (debug_printf("[pngle] Allocating %zu bytes for %s\n", (size_t)(a) * (size_t)(b), (name)), \
-    calloc((size_t)(a), (size_t)(b)))
+    pngle->allocator.calloc(pngle->allocator.user_data, (size_t)(a), (size_t)(b)))
+#define PNGLE_FREE(p) pngle->allocator.free(pngle->allocator.user_data, (p))
 
 #define PNGLE_UNUSED(x) (void)(x)
 
@@ -73,6 +77,8 @@ typedef enum {
 
 // typedef struct _pngle_t pngle_t; // declared in pngle.h
 struct _pngle_t {
+  pngle_allocator_t allocator;
+
   pngle_ihdr_t hdr;
 
   uint_fast8_t channels; // 0 indicates IHDR hasn't been processed yet
@@ -88,17 +94,18 @@ struct _pngle_t {
   // parser state (reset on every chunk header)
   pngle_state_t state;
   uint32_t chunk_type;
+  uint32_t chunk_length;
   uint32_t chunk_remain;
-  mz_ulong crc32;
+  uint32_t crc32;
 
   // decompression state (reset on IHDR)
-  tinfl_decompressor inflator; // 11000 bytes
-  uint8_t lz_buf[TINFL_LZ_DICT_SIZE]; // 32768 bytes
+  void* inflator; // pngle_inflate_backend.state_size bytes (~11000 bytes for tinfl)
+  uint8_t lz_buf[PNGLE_INFLATE_DICT_SIZE]; // 32768 bytes
   uint8_t* next_out; // NULL indicates IDAT hasn't been processed yet
   size_t avail_out;
 
   // scanline decoder (reset on every set_interlace_pass() call)
-  uint8_t* scanline_ringbuf;
+  uint8_t* scanline_ringbuf; // allocated once for the widest pass
   size_t scanline_ringbuf_size;
   size_t scanline_ringbuf_cidx;
   int_fast8_t scanline_remain_bytes_to_render;
@@ -109,6 +116,17 @@ struct _pngle_t {
   // interlace
   uint_fast8_t interlace_pass;
 
+  // viewport (set by pngle_set_viewport(), width 0 for whole image) and its clip rect (on IHDR)
+  uint32_t viewport_x;
+  uint32_t viewport_y;
+  uint32_t viewport_w;
+  uint32_t viewport_h;
+  uint32_t clip_left;
+  uint32_t clip_top;
+  uint32_t clip_right;
+  uint32_t clip_bottom;
+  size_t skip_remain_bytes; // of pass rows below viewport, they are inflated only
+
   const char* error;
 
 #ifndef PNGLE_NO_GAMMA_CORRECTION
@@ -119,6 +137,7 @@ struct _pngle_t {
   pngle_init_callback_t init_callback;
   pngle_draw_callback_t draw_callback;
   pngle_done_callback_t done_callback;
+  pngle_chunk_callback_t chunk_callback;
 
   void* user_data;
 };
@@ -151,11 +170,11 @@ void pngle_reset(pngle_t* pngle) {
   pngle->state = PNGLE_STATE_INITIAL;
   pngle->error = "No error";
 
-  if (pngle->scanline_ringbuf) free(pngle->scanline_ringbuf);
-  if (pngle->palette) free(pngle->palette);
-  if (pngle->trans_palette) free(pngle->trans_palette);
+  if (pngle->scanline_ringbuf) PNGLE_FREE(pngle->scanline_ringbuf);
+  if (pngle->palette) PNGLE_FREE(pngle->palette);
+  if (pngle->trans_palette) PNGLE_FREE(pngle->trans_palette);
 #ifndef PNGLE_NO_GAMMA_CORRECTION
-  if (pngle->gamma_table) free(pngle->gamma_table);
+  if (pngle->gamma_table) PNGLE_FREE(pngle->gamma_table);
 #endif
 
   pngle->scanline_ringbuf = NULL;
@@ -173,12 +192,37 @@ void pngle_reset(pngle_t* pngle) {
   pngle->n_palettes = 0;
   pngle->n_trans_palettes = 0;
 
-  tinfl_init(&pngle->inflator);
+  pngle_inflate_backend.init(pngle->inflator);
+}
+
+static void* default_calloc(void* user_data, size_t n, size_t size) {
+  PNGLE_UNUSED(user_data);
+  return calloc(n, size);
+}
+
+static void default_free(void* user_data, void* p) {
+  PNGLE_UNUSED(user_data);
+  free(p);
 }
 
 pngle_t* pngle_new() {
-  pngle_t* pngle = (pngle_t*)PNGLE_CALLOC(1, sizeof(pngle_t), "pngle_t");
+  return pngle_new_with_allocator(NULL);
+}
+
+pngle_t* pngle_new_with_allocator(const pngle_allocator_t* allocator) {
+  static const pngle_allocator_t default_allocator = {default_calloc, default_free, NULL};
+  if (!allocator) allocator = &default_allocator;
+
+  debug_printf("[pngle] Allocating %zu bytes for pngle_t\n", sizeof(pngle_t));
+  pngle_t* pngle = (pngle_t*)allocator->calloc(allocator->user_data, 1, sizeof(pngle_t));
   if (!pngle) return NULL;
+  pngle->allocator = *allocator;
+
+  pngle->inflator = PNGLE_CALLOC(1, pngle_inflate_backend.state_size, "inflator");
+  if (!pngle->inflator) {
+    allocator->free(allocator->user_data, pngle);
+    return NULL;
+  }
 
   pngle_reset(pngle);
 
@@ -188,7 +232,10 @@ pngle_t* pngle_new() {
 void pngle_destroy(pngle_t* pngle) {
   if (pngle) {
     pngle_reset(pngle);
-    free(pngle);
+    PNGLE_FREE(pngle->inflator);
+
+    pngle_allocator_t allocator = pngle->allocator;
+    allocator.free(allocator.user_data, pngle);
   }
 }
 
@@ -268,12 +315,30 @@ static int pngle_draw_pixels(pngle_t* pngle, size_t scanline_ringbuf_xidx) {
 
   int n_pixels = pngle->hdr.depth == 16 ? 1 : (8 / pngle->hdr.depth);
 
+  // pixels are drawn as blocks covering pixels of following interlace passes, block is clipped to viewport
+  uint32_t block_w = interlace_div_x[pngle->interlace_pass] - interlace_off_x[pngle->interlace_pass];
+  uint32_t block_h = interlace_div_y[pngle->interlace_pass] - interlace_off_y[pngle->interlace_pass];
+  uint32_t top = MAX(pngle->drawing_y, pngle->clip_top);
+  uint32_t bottom = MIN(pngle->drawing_y + block_h, pngle->clip_bottom);
+
+  if (top >= bottom) {
+    // rows above viewport are unfiltered (following rows depend on them), but not converted to pixels
+    for (; n_pixels-- > 0 && pngle->drawing_x < pngle->hdr.width;
+         pngle->drawing_x = U32_CLAMP_ADD(pngle->drawing_x, interlace_div_x[pngle->interlace_pass], pngle->hdr.width))
+      ;
+    return 0;
+  }
+
   for (; n_pixels-- > 0 && pngle->drawing_x < pngle->hdr.width;
        pngle->drawing_x = U32_CLAMP_ADD(pngle->drawing_x, interlace_div_x[pngle->interlace_pass], pngle->hdr.width)) {
     for (uint_fast8_t c = 0; c < pngle->channels; c++) {
       v[c] = get_value(pngle, &scanline_ringbuf_xidx, &bitcount, pngle->hdr.depth);
     }
 
+    uint32_t left = MAX(pngle->drawing_x, pngle->clip_left);
+    uint32_t right = MIN(pngle->drawing_x + block_w, pngle->clip_right);
+    if (left >= right) continue; // out of viewport
+
     // color type: 0000 0111
     //                     ^-- indexed color (palette)
     //                    ^--- Color
@@ -320,14 +385,8 @@ static int pngle_draw_pixels(pngle_t* pngle, size_t scanline_ringbuf_xidx) {
       }
 #endif
 
-      pngle->draw_callback(pngle,
-        pngle->drawing_x,
-        pngle->drawing_y,
-        MIN(interlace_div_x[pngle->interlace_pass] - interlace_off_x[pngle->interlace_pass],
-          pngle->hdr.width - pngle->drawing_x),
-        MIN(interlace_div_y[pngle->interlace_pass] - interlace_off_y[pngle->interlace_pass],
-          pngle->hdr.height - pngle->drawing_y),
-        rgba);
+      pngle->draw_callback(
+        pngle, left - pngle->clip_left, top - pngle->clip_top, right - left, bottom - top, rgba);
     }
   }
 
@@ -356,9 +415,14 @@ static int set_interlace_pass(pngle_t* pngle, uint_fast8_t pass) {
 
   pngle->scanline_ringbuf_size = scanline_stride + bytes_per_pixel * 2; // 2 rooms for c/x and a
 
-  if (pngle->scanline_ringbuf) free(pngle->scanline_ringbuf);
-  if ((pngle->scanline_ringbuf = PNGLE_CALLOC(pngle->scanline_ringbuf_size, 1, "scanline ringbuf")) == NULL)
-    return PNGLE_ERROR("Insufficient memory");
+  if (!pngle->scanline_ringbuf) {
+    // full width scanline (non-interlaced or pass 7) is the widest, following passes reuse the buffer
+    size_t capacity = ((size_t)pngle->hdr.width * pngle->channels * pngle->hdr.depth + 7) / 8 + bytes_per_pixel * 2;
+    if ((pngle->scanline_ringbuf = PNGLE_CALLOC(capacity, 1, "scanline ringbuf")) == NULL)
+      return PNGLE_ERROR("Insufficient memory");
+  } else {
+    memset(pngle->scanline_ringbuf, 0, pngle->scanline_ringbuf_size);
+  }
 
   pngle->drawing_x = interlace_off_x[pngle->interlace_pass];
   pngle->drawing_y = interlace_off_y[pngle->interlace_pass];
@@ -366,13 +430,34 @@ static int set_interlace_pass(pngle_t* pngle, uint_fast8_t pass) {
 
   pngle->scanline_ringbuf_cidx = 0;
   pngle->scanline_remain_bytes_to_render = -1;
+  pngle->skip_remain_bytes = 0;
 
   return 0;
 }
 
+static int setup_viewport(pngle_t* pngle) {
+  if (pngle->viewport_w == 0 || pngle->viewport_h == 0) {
+    pngle->clip_left = 0;
+    pngle->clip_top = 0;
+    pngle->clip_right = pngle->hdr.width;
+    pngle->clip_bottom = pngle->hdr.height;
+    return 0;
+  }
+
+  if (pngle->viewport_x >= pngle->hdr.width || pngle->viewport_y >= pngle->hdr.height)
+    return PNGLE_ERROR("Viewport is out of the image");
+
+  pngle->clip_left = pngle->viewport_x;
+  pngle->clip_top = pngle->viewport_y;
+  pngle->clip_right = U32_CLAMP_ADD(pngle->viewport_x, pngle->viewport_w, pngle->hdr.width);
+  pngle->clip_bottom = U32_CLAMP_ADD(pngle->viewport_y, pngle->viewport_h, pngle->hdr.height);
+  return 0;
+}
+
 static int setup_gamma_table(pngle_t* pngle, uint32_t png_gamma) {
 #ifndef PNGLE_NO_GAMMA_CORRECTION
-  if (pngle->gamma_table) free(pngle->gamma_table);
+  if (pngle->gamma_table) PNGLE_FREE(pngle->gamma_table);
+  pngle->gamma_table = NULL;
 
   if (pngle->display_gamma <= 0) return 0; // disable gamma correction
   if (png_gamma == 0) return 0;
@@ -401,6 +486,18 @@ static int pngle_on_data(pngle_t* pngle, const uint8_t* p, int len) {
   uint_fast8_t bytes_per_pixel = (pngle->channels * pngle->hdr.depth + 7) / 8; // 1 if depth <= 8
 
   while (p < ep) {
+    if (pngle->skip_remain_bytes > 0) {
+      size_t n = MIN((size_t)(ep - p), pngle->skip_remain_bytes);
+      p += n;
+      pngle->skip_remain_bytes -= n;
+      if (pngle->skip_remain_bytes == 0) {
+        // end of pass
+        pngle->drawing_x = pngle->hdr.width;
+        pngle->drawing_y = pngle->hdr.height;
+      }
+      continue;
+    }
+
     if (pngle->drawing_x >= pngle->hdr.width) {
       // New row
       pngle->drawing_x = interlace_off_x[pngle->interlace_pass];
@@ -418,6 +515,15 @@ static int pngle_on_data(pngle_t* pngle, const uint8_t* p, int len) {
       continue; // This is required because "No filter type bytes are present in an empty pass".
     }
 
+    if (pngle->filter_type < 0 && pngle->drawing_y >= pngle->clip_bottom) {
+      // no pixel in viewport depends on rows below it, rest of the pass (filter type + scanline per row) is skipped
+      uint32_t div_y = interlace_div_y[pngle->interlace_pass];
+      size_t rows = (pngle->hdr.height - pngle->drawing_y + div_y - 1) / div_y;
+      size_t scanline_stride = pngle->scanline_ringbuf_size - bytes_per_pixel * 2;
+      pngle->skip_remain_bytes = rows * (1 + scanline_stride);
+      continue;
+    }
+
     if (pngle->filter_type < 0) {
       if (*p > 4) {
         debug_printf("[pngle] Invalid filter type is found; 0x%02x\n", *p);
@@ -563,8 +669,11 @@ static int pngle_handle_chunk(pngle_t* pngle, const uint8_t* buf, size_t len) {
       // interlace
       if (set_interlace_pass(pngle, pngle->hdr.interlace ? 1 : 0) < 0) return -1;
 
+      if (setup_viewport(pngle) < 0) return -1;
+
       // callback
-      if (pngle->init_callback) pngle->init_callback(pngle, pngle->hdr.width, pngle->hdr.height);
+      if (pngle->init_callback)
+        pngle->init_callback(pngle, pngle->clip_right - pngle->clip_left, pngle->clip_bottom - pngle->clip_top);
 
       break;
 
@@ -580,21 +689,16 @@ static int pngle_handle_chunk(pngle_t* pngle, const uint8_t* buf, size_t len) {
       // debug_printf("[pngle]     in_bytes %zd, out_bytes %zd, next_out %p\n", in_bytes, out_bytes, pngle->next_out);
 
       // XXX: tinfl_decompress always requires (next_out - lz_buf + avail_out) == TINFL_LZ_DICT_SIZE
-      tinfl_status status = tinfl_decompress(&pngle->inflator,
-        (const mz_uint8*)buf,
-        &in_bytes,
-        pngle->lz_buf,
-        (mz_uint8*)pngle->next_out,
-        &out_bytes,
-        TINFL_FLAG_HAS_MORE_INPUT | TINFL_FLAG_PARSE_ZLIB_HEADER);
-
-      // debug_printf("[pngle]       tinfl_decompress\n");
+      pngle_inflate_status_t status = pngle_inflate_backend.decompress(
+        pngle->inflator, buf, &in_bytes, pngle->lz_buf, pngle->next_out, &out_bytes);
+
+      // debug_printf("[pngle]       %s decompress\n", pngle_inflate_backend.name);
       // debug_printf("[pngle]       => in_bytes %zd, out_bytes %zd, next_out %p, status %d\n", in_bytes, out_bytes,
       // pngle->next_out, status);
 
-      if (status < TINFL_STATUS_DONE) {
+      if (status == PNGLE_INFLATE_FAILED) {
         // Decompression failed.
-        debug_printf("[pngle] tinfl_decompress() failed with status %d!\n", status);
+        debug_printf("[pngle] %s decompress failed!\n", pngle_inflate_backend.name);
         return PNGLE_ERROR("Failed to decompress the IDAT stream");
       }
 
@@ -603,18 +707,18 @@ static int pngle_handle_chunk(pngle_t* pngle, const uint8_t* buf, size_t len) {
 
       // debug_printf("[pngle]         => avail_out %zd, next_out %p\n", pngle->avail_out, pngle->next_out);
 
-      if (status == TINFL_STATUS_DONE || pngle->avail_out == 0) {
+      if (status == PNGLE_INFLATE_DONE || pngle->avail_out == 0) {
         // Output buffer is full, or decompression is done, so write buffer to output file.
         // XXX: This is the only chance to process the buffer.
         uint8_t* read_ptr = pngle->lz_buf;
-        size_t n = TINFL_LZ_DICT_SIZE - (size_t)pngle->avail_out;
+        size_t n = PNGLE_INFLATE_DICT_SIZE - (size_t)pngle->avail_out;
 
         // pngle_on_data() usually returns n, otherwise -1 on error
         if (pngle_on_data(pngle, read_ptr, n) < 0) return -1;
 
         // XXX: tinfl_decompress always requires (next_out - lz_buf + avail_out) == TINFL_LZ_DICT_SIZE
         pngle->next_out = pngle->lz_buf;
-        pngle->avail_out = TINFL_LZ_DICT_SIZE;
+        pngle->avail_out = PNGLE_INFLATE_DICT_SIZE;
       }
 
       consume = in_bytes;
@@ -674,6 +778,11 @@ static int pngle_handle_chunk(pngle_t* pngle, const uint8_t* buf, size_t len) {
       // unknown chunk
       consume = len;
 
+      if (pngle->chunk_callback) {
+        uint32_t offset = pngle->chunk_length - pngle->chunk_remain;
+        pngle->chunk_callback(pngle, pngle->chunk_type, buf, consume, offset, pngle->chunk_length);
+      }
+
       debug_printf("[pngle] Unknown chunk; %zd bytes discarded\n", consume);
       break;
   }
@@ -706,9 +815,10 @@ static int pngle_feed_internal(pngle_t* pngle, const uint8_t* buf, size_t len) {
       if (len < 8) return 0;
 
       pngle->chunk_remain = read_uint32(buf);
+      pngle->chunk_length = pngle->chunk_remain;
       pngle->chunk_type = read_uint32(buf + 4);
 
-      pngle->crc32 = mz_crc32(MZ_CRC32_INIT, (const mz_uint8*)(buf + 4), 4);
+      pngle->crc32 = pngle_inflate_backend.crc32(0, buf + 4, 4);
 
       debug_printf("[pngle] Chunk '%.4s' len %u\n", buf + 4, pngle->chunk_remain);
 
@@ -729,7 +839,7 @@ static int pngle_feed_internal(pngle_t* pngle, const uint8_t* buf, size_t len) {
           if (pngle->next_out == NULL) {
             // Very first IDAT
             pngle->next_out = pngle->lz_buf;
-            pngle->avail_out = TINFL_LZ_DICT_SIZE;
+            pngle->avail_out = PNGLE_INFLATE_DICT_SIZE;
           }
           break;
 
@@ -801,7 +911,7 @@ static int pngle_feed_internal(pngle_t* pngle, const uint8_t* buf, size_t len) {
         if (pngle->chunk_remain < (uint32_t)consumed) return PNGLE_ERROR("Chunk data has been consumed too much");
 
         pngle->chunk_remain -= consumed;
-        pngle->crc32 = mz_crc32(pngle->crc32, (const mz_uint8*)buf, consumed);
+        pngle->crc32 = pngle_inflate_backend.crc32(pngle->crc32, buf, consumed);
       }
       if (pngle->chunk_remain <= 0) pngle->state = PNGLE_STATE_CRC;
 
@@ -877,6 +987,19 @@ void pngle_set_done_callback(pngle_t* pngle, pngle_done_callback_t callback) {
   pngle->done_callback = callback;
 }
 
+void pngle_set_chunk_callback(pngle_t* pngle, pngle_chunk_callback_t callback) {
+  if (!pngle) return;
+  pngle->chunk_callback = callback;
+}
+
+void pngle_set_viewport(pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+  if (!pngle) return;
+  pngle->viewport_x = x;
+  pngle->viewport_y = y;
+  pngle->viewport_w = w;
+  pngle->viewport_h = h;
+}
+
 void pngle_set_user_data(pngle_t* pngle, void* user_data) {
   if (!pngle) return;
   pngle->user_data = user_data;
@@ -887,4 +1010,8 @@ void* pngle_get_user_data(pngle_t* pngle) {
   return pngle->user_data;
 }
 
+const char* pngle_get_inflate_backend_name() {
+  return pngle_inflate_backend.name;
+}
+
 /* vim: set ts=4 sw=4 noexpandtab: */
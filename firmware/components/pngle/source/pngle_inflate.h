@@ -0,0 +1,39 @@
+#ifndef __PNGLE_INFLATE_H__
+#define __PNGLE_INFLATE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Inflate backend interface (internal)
+//
+// Exactly one backend source is compiled in (see Kconfig / CMakeLists.txt) and it defines
+// `pngle_inflate_backend`. Every backend has to behave like tinfl_decompress() with
+// TINFL_FLAG_HAS_MORE_INPUT | TINFL_FLAG_PARSE_ZLIB_HEADER flags, i.e. it decodes zlib stream into
+// a wrapping dictionary of PNGLE_INFLATE_DICT_SIZE bytes which is also the output buffer.
+
+#define PNGLE_INFLATE_DICT_SIZE 32768
+
+typedef enum {
+  PNGLE_INFLATE_FAILED = -1,
+  PNGLE_INFLATE_DONE = 0,
+  PNGLE_INFLATE_NEEDS_MORE_INPUT = 1,
+  PNGLE_INFLATE_HAS_MORE_OUTPUT = 2,
+} pngle_inflate_status_t;
+
+typedef struct _pngle_inflate_backend_t {
+  const char* name;
+  size_t state_size; // bytes of backend state allocated by pngle_new()
+
+  void (*init)(void* state);
+
+  // in_bytes/out_bytes: available bytes on input, consumed/produced bytes on output
+  pngle_inflate_status_t (*decompress)(
+    void* state, const uint8_t* in, size_t* in_bytes, uint8_t* dict, uint8_t* next_out, size_t* out_bytes);
+
+  // zlib compatible crc32 (used for chunk CRC)
+  uint32_t (*crc32)(uint32_t crc, const uint8_t* buf, size_t len);
+} pngle_inflate_backend_t;
+
+extern const pngle_inflate_backend_t pngle_inflate_backend;
+
+#endif /* __PNGLE_INFLATE_H__ */
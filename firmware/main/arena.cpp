@@ -0,0 +1,86 @@
+#include "arena.hpp"
+
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "waveshare_it8951.hpp"
+
+#include <algorithm>
+
+namespace {
+// pixel buffer and general buffer of the display driver
+constexpr std::size_t dmaArenaSize = WaveshareIT8951::defaultPixelBufferSize + 1024;
+// pngle_t (32 kB dictionary), inflator (~11 kB) and scanline of 1200 px wide RGBA 16 bit image
+constexpr std::size_t decoderArenaSize = 56 * 1024;
+
+DMA_ATTR uint8_t dmaArenaMemory[dmaArenaSize];
+EXT_RAM_ATTR uint32_t decoderArenaMemory[decoderArenaSize / sizeof(uint32_t)];
+} // namespace
+
+Arena::Arena(uint8_t* memory, std::size_t size) : _memory{memory}, _size{size} {
+}
+
+void* Arena::allocate(std::size_t size) {
+  const std::size_t alignedSize = (size + 3) & ~std::size_t{3};
+  if (_used + headerSize + alignedSize > _size) {
+    _overflows++;
+    return nullptr;
+  }
+
+  *reinterpret_cast<uint32_t*>(_memory + _used) = alignedSize;
+  uint8_t* block = _memory + _used + headerSize;
+  _used += headerSize + alignedSize;
+  _highWater = std::max(_highWater, _used);
+  return block;
+}
+
+bool Arena::release(void* p) {
+  if (!contains(p)) return false;
+
+  uint8_t* block = static_cast<uint8_t*>(p);
+  const uint32_t blockSize = *reinterpret_cast<const uint32_t*>(block - headerSize);
+  if (block + blockSize == _memory + _used) _used = block - headerSize - _memory;
+  return true;
+}
+
+void Arena::reset() {
+  _used = 0;
+}
+
+void* Arena::allocateOrHeap(std::size_t size, uint32_t caps) {
+  void* p = allocate(size);
+  return p != nullptr ? p : heap_caps_malloc(size, caps);
+}
+
+void Arena::releaseOrHeap(void* p) {
+  if (!release(p)) heap_caps_free(p);
+}
+
+bool Arena::contains(const void* p) const {
+  return p >= _memory && p < _memory + _size;
+}
+
+std::size_t Arena::size() const {
+  return _size;
+}
+
+std::size_t Arena::used() const {
+  return _used;
+}
+
+std::size_t Arena::highWater() const {
+  return _highWater;
+}
+
+uint32_t Arena::overflows() const {
+  return _overflows;
+}
+
+Arena& dmaArena() {
+  static Arena arena{dmaArenaMemory, sizeof(dmaArenaMemory)};
+  return arena;
+}
+
+Arena& decoderArena() {
+  static Arena arena{reinterpret_cast<uint8_t*>(decoderArenaMemory), sizeof(decoderArenaMemory)};
+  return arena;
+}
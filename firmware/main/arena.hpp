@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Bump allocator over a static memory block, so long lived buffers of every wake don't fragment the heap. Only the
+// last allocation can be released alone (LIFO), others are released all at once by reset(). Allocations which don't
+// fit are served by the heap and counted as overflows, high-water mark tells how large the block has to be.
+class Arena {
+  // NOTE every block is preceded by its size, so LIFO releases can be chained
+  static constexpr std::size_t headerSize = sizeof(uint32_t);
+
+  uint8_t* _memory;
+  std::size_t _size;
+  std::size_t _used{};
+  std::size_t _highWater{};
+  uint32_t _overflows{};
+
+public:
+  // memory has to be word aligned
+  Arena(uint8_t* memory, std::size_t size);
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  // returns word aligned block, nullptr when the arena is full
+  void* allocate(std::size_t size);
+  // returns false when p isn't from the arena
+  bool release(void* p);
+  void reset();
+
+  // heap with capabilities (MALLOC_CAP_*) is used when the arena is full
+  void* allocateOrHeap(std::size_t size, uint32_t caps);
+  void releaseOrHeap(void* p);
+
+  bool contains(const void* p) const;
+  std::size_t size() const;
+  std::size_t used() const;
+  std::size_t highWater() const;
+  uint32_t overflows() const;
+};
+
+// DMA capable internal memory for display strips
+Arena& dmaArena();
+// decoder state (pngle), in PSRAM when static data are allowed there
+Arena& decoderArena();
@@ -0,0 +1,96 @@
+#include "broker_address.hpp"
+
+#include "esp_netif.h"
+#include "frame_hash.hpp"
+#include "lwip/sockets.h"
+#include "simple_logger.hpp"
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <sys/time.h>
+
+const char* TAG_BROKER_ADDRESS = "brokerAddress";
+
+extern "C" int __real_esp_tls_conn_new_sync(
+  const char* hostname, int hostlen, int port, const esp_tls_cfg_t* cfg, esp_tls_t* tls);
+
+namespace {
+// DNS record is looked up again after
+constexpr int64_t addressTime = 60 * 60;
+
+int64_t rtcTime() {
+  timeval now{};
+  gettimeofday(&now, nullptr);
+  return now.tv_sec;
+}
+
+uint32_t hashServer(std::string_view host, int port) {
+  FrameHash hash{};
+  hash.update(reinterpret_cast<const uint8_t*>(host.data()), host.size());
+  hash.update(reinterpret_cast<const uint8_t*>(&port), sizeof(port));
+  return hash.value;
+}
+} // namespace
+
+BrokerAddressCache::BrokerAddressCache(State& state) : _state{state} {}
+
+int BrokerAddressCache::connect(
+  const char* host, int hostLength, int port, const esp_tls_cfg_t& config, esp_tls_t* tls) {
+  const uint32_t serverHash = hashServer({host, static_cast<std::size_t>(hostLength)}, port);
+  if (_state.serverHash != serverHash) {
+    // other broker in settings
+    _state = {serverHash, 0, 0};
+  }
+
+  _isUsed = hasAddress() && config.common_name == nullptr;
+  if (!_isUsed) return connectByName(host, hostLength, port, config, tls);
+
+  // NOTE name of the broker (not the address) is verified by its certificate and sent as SNI
+  char address[16] = {};
+  const esp_ip4_addr_t ip{_state.address};
+  esp_ip4addr_ntoa(&ip, address, sizeof(address));
+  const std::string name{host, static_cast<std::size_t>(hostLength)};
+  esp_tls_cfg_t addressConfig = config;
+  addressConfig.common_name = name.c_str();
+
+  const int result = __real_esp_tls_conn_new_sync(address, std::strlen(address), port, &addressConfig, tls);
+  if (result == 1) return result;
+
+  logW(TAG_BROKER_ADDRESS, "connection to cached address %s failed, dropping it", address);
+  _state.address = 0;
+  _isUsed = false;
+  // NOTE TLS state of failed handshake can't be reused, the reconnect of MQTT client looks the name up then
+  if (tls->conn_state != ESP_TLS_INIT) return result;
+  return connectByName(host, hostLength, port, config, tls);
+}
+
+bool BrokerAddressCache::isUsed() const {
+  return _isUsed;
+}
+
+bool BrokerAddressCache::hasAddress() const {
+  // NOTE time set by SNTP in the meantime moves RTC time, address is looked up then
+  const int64_t elapsed = rtcTime() - _state.lookupTime;
+  return _state.address != 0 && elapsed >= 0 && elapsed < addressTime;
+}
+
+int BrokerAddressCache::connectByName(
+  const char* host, int hostLength, int port, const esp_tls_cfg_t& config, esp_tls_t* tls) {
+  const int result = __real_esp_tls_conn_new_sync(host, hostLength, port, &config, tls);
+  if (result == 1) store(tls);
+  return result;
+}
+
+void BrokerAddressCache::store(esp_tls_t* tls) {
+  int socket = -1;
+  sockaddr_in peer{};
+  socklen_t peerSize = sizeof(peer);
+  if (esp_tls_get_conn_sockfd(tls, &socket) != ESP_OK ||
+    getpeername(socket, reinterpret_cast<sockaddr*>(&peer), &peerSize) != 0 || peer.sin_family != AF_INET) {
+    return;
+  }
+
+  _state.address = peer.sin_addr.s_addr;
+  _state.lookupTime = rtcTime();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "esp_tls.h"
+
+#include <cstdint>
+
+// Address of MQTT broker kept in RTC memory. Connections of the following hour go to the cached address without DNS
+// lookup, certificate is verified (and SNI sent) for the broker name. When the cached address can't be reached, the
+// same connect looks the name up, address which accepts the connection but fails the handshake is dropped and the
+// reconnect looks it up.
+//
+// It's a step of TlsSessionCache::connect() (esp_tls_conn_new_sync() wrapped by linker).
+class BrokerAddressCache {
+public:
+  // survives deep sleep, zero after power on
+  struct State {
+    uint32_t serverHash; // host and port of the address
+    uint32_t address; // IPv4 in network byte order as esp_ip4_addr_t, 0 = none
+    int64_t lookupTime; // RTC time of DNS lookup in seconds
+  };
+
+private:
+  State& _state;
+  bool _isUsed{};
+
+public:
+  explicit BrokerAddressCache(State& state);
+
+  // esp_tls_conn_new_sync() to cached address of the host, by the host name when there is none or it's unreachable
+  int connect(const char* host, int hostLength, int port, const esp_tls_cfg_t& config, esp_tls_t* tls);
+
+  // the last connection went to cached address
+  bool isUsed() const;
+
+private:
+  bool hasAddress() const;
+  int connectByName(const char* host, int hostLength, int port, const esp_tls_cfg_t& config, esp_tls_t* tls);
+  void store(esp_tls_t* tls);
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "exception.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/stream_buffer.h"
+#include "freertos/task.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+// Single producer / single consumer byte ring (FreeRTOS stream buffer) passing MQTT message chunks from the MQTT
+// client task to the decode task. Every chunk is a header followed by its data. Producer waits while the ring is
+// full, so the MQTT task stops reading the socket and TCP flow control slows the sender down.
+//
+// NOTE MQTT task holds the client API lock while it waits, so the wait is bounded: decode task which subscribes or
+// publishes meanwhile would never drain the ring. Chunk which doesn't fit in time is dropped with the rest of its
+// message, closed ring (decoding finished, going to sleep) drops everything.
+struct ChunkRing {
+  enum class Kind : uint32_t {
+    DATA,
+    UNCHANGED, // no data, content of the topic is the same as drawn (see image version)
+  };
+
+  struct Header {
+    uint32_t topicIndex;
+    uint32_t offset; // in message
+    uint32_t totalLength; // of message
+    uint32_t size;
+    Kind kind{Kind::DATA};
+  };
+
+private:
+  StreamBufferHandle_t _buffer;
+  std::size_t _maxPieceSize;
+  TickType_t _sendTimeout;
+  std::atomic<bool> _isClosed{};
+  bool _isDroppingMessage{};
+
+public:
+  explicit ChunkRing(std::size_t size, TickType_t sendTimeout = pdMS_TO_TICKS(2000)) :
+    _buffer{xStreamBufferCreate(size, 1)}, _maxPieceSize{size / 2 - sizeof(Header)}, _sendTimeout{sendTimeout} {
+    if (_buffer == nullptr) throw Exception("Couldn't create chunk ring");
+  }
+
+  ~ChunkRing() {
+    vStreamBufferDelete(_buffer);
+  }
+
+  ChunkRing(const ChunkRing&) = delete;
+  ChunkRing& operator=(const ChunkRing&) = delete;
+
+  // chunk is split into pieces of at most half of the ring and every piece (header with its data) is written whole,
+  // so dropped piece never leaves a torn one behind; returns false when the chunk is dropped
+  bool push(const Header& header, const uint8_t* data) {
+    if (header.offset == 0) _isDroppingMessage = false;
+    if (_isClosed || _isDroppingMessage) return false;
+
+    uint32_t done = 0;
+    do {
+      const uint32_t size = std::min<uint32_t>(header.size - done, _maxPieceSize);
+      const Header piece{header.topicIndex, header.offset + done, header.totalLength, size, header.kind};
+      if (!waitForSpace(sizeof(piece) + size)) {
+        _isDroppingMessage = true;
+        return false;
+      }
+      // NOTE single producer, nobody else takes the space
+      xStreamBufferSend(_buffer, &piece, sizeof(piece), 0);
+      if (size > 0) xStreamBufferSend(_buffer, data + done, size, 0);
+      done += size;
+    } while (done < header.size);
+    return true;
+  }
+
+  // following chunks are dropped, decode task doesn't take more
+  void close() {
+    _isClosed = true;
+  }
+
+  // blocks until the next chunk arrives, its data have to be read by receive() before the next header
+  Header receiveHeader() {
+    Header header{};
+    receive(reinterpret_cast<uint8_t*>(&header), sizeof(header));
+    return header;
+  }
+
+  void receive(uint8_t* data, std::size_t size) {
+    while (size > 0) {
+      const std::size_t received = xStreamBufferReceive(_buffer, data, size, portMAX_DELAY);
+      data += received;
+      size -= received;
+    }
+  }
+
+private:
+  bool waitForSpace(std::size_t size) {
+    const TickType_t start = xTaskGetTickCount();
+    while (xStreamBufferSpacesAvailable(_buffer) < size) {
+      if (_isClosed || xTaskGetTickCount() - start >= _sendTimeout) return false;
+      vTaskDelay(1);
+    }
+    return !_isClosed;
+  }
+};
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <optional>
+#include <string>
+
+// Minute clock drawn by the device itself. RTC keeps time in deep sleep, so most wakes only redraw the clock box with
+// fast waveform and WiFi stays off. Network wake comes every sync interval, when content change announced by the
+// server is due, or while the time isn't known (it's set by SNTP on network wakes).
+class LocalClock {
+public:
+  // survives deep sleep, zero after power on
+  struct State {
+    int64_t lastNetworkMinute; // seconds since epoch of the minute shown on the last network wake
+    int64_t nextContentTime; // announced by server, 0 = none
+    uint32_t localWakes; // since the last network wake
+    bool isTimeSet;
+  };
+
+  // top left corner of the clock box and scale of its font
+  struct Placement {
+    uint16_t x;
+    uint16_t y;
+    uint8_t scale;
+  };
+
+  static constexpr int64_t minute = 60;
+  // wake which comes a bit early (RTC slow clock drifts) shows the coming minute
+  static constexpr int64_t earlyWake = 5;
+  static constexpr uint8_t maxScale = 8;
+
+  // "x,y" or "x,y,scale", x multiple of 4
+  static std::optional<Placement> parsePlacement(const std::string& text) {
+    unsigned x = 0, y = 0, scale = 1;
+    char rest = 0;
+    const int count = std::sscanf(text.c_str(), "%u,%u,%u%c", &x, &y, &scale, &rest);
+    if (count != 2 && count != 3) return std::nullopt;
+    if (x % 4 != 0 || x > UINT16_MAX || y > UINT16_MAX || scale == 0 || scale > maxScale) return std::nullopt;
+    return Placement{static_cast<uint16_t>(x), static_cast<uint16_t>(y), static_cast<uint8_t>(scale)};
+  }
+
+  // seconds since epoch of the minute to show at time now
+  static int64_t shownMinute(int64_t now) {
+    return (now + earlyWake) / minute * minute;
+  }
+
+  // interval in minutes
+  static bool isNetworkWakeDue(const State& state, int64_t now, uint32_t interval) {
+    if (!state.isTimeSet) return true;
+    if (state.nextContentTime != 0 && now + earlyWake >= state.nextContentTime) return true;
+
+    const int64_t elapsed = shownMinute(now) - state.lastNetworkMinute;
+    // NOTE time going backwards (eg. RTC reset) is due as well
+    return elapsed < 0 || elapsed >= static_cast<int64_t>(interval) * minute;
+  }
+
+  // microseconds from now to the beginning of the next minute, a minute later when it's too close to wake up for it
+  static int64_t sleepTime(int64_t nowUs) {
+    constexpr int64_t second = 1'000'000;
+    const int64_t next = (nowUs / (minute * second) + 1) * minute * second;
+    const int64_t time = next - nowUs;
+    return time < earlyWake * second ? time + minute * second : time;
+  }
+
+  // "HH:MM" in local time zone (TZ)
+  static std::string format(int64_t time) {
+    const std::time_t t = time;
+    std::tm local{};
+    localtime_r(&t, &local);
+    char text[8];
+    std::strftime(text, sizeof(text), "%H:%M", &local);
+    return text;
+  }
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Reduces 8 bit gray to 16 gray levels (4bpp) of the display.
+//
+// Error diffusion expects pixels in row-major order (as non-interlaced PNG is decoded) and keeps only error rows
+// ahead of the current row (one for Floyd-Steinberg, two for Atkinson), so it works across flushed pixel strips.
+struct Ditherer {
+  enum class Mode { NONE, FLOYD_STEINBERG, ATKINSON, BAYER };
+
+private:
+  static constexpr int levelStep = 17; // 255 / 15
+  static constexpr std::size_t rowPadding = 2; // error is diffused up to 2 pixels to left and right
+
+  static constexpr std::array<std::array<uint8_t, 4>, 4> bayer4{{
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+  }};
+
+  Mode _mode{Mode::NONE};
+  uint32_t _width{};
+  uint32_t _currentY{};
+  // ring of error rows, _errors[_currentY % rows] holds error diffused into current row
+  std::vector<std::vector<int16_t>> _errors{};
+
+public:
+  static Mode parseMode(std::string_view name, Mode fallback = Mode::NONE) {
+    if (name == "none") return Mode::NONE;
+    if (name == "floyd-steinberg" || name == "fs") return Mode::FLOYD_STEINBERG;
+    if (name == "atkinson") return Mode::ATKINSON;
+    if (name == "bayer") return Mode::BAYER;
+    return fallback;
+  }
+
+  static const char* modeName(Mode mode) {
+    switch (mode) {
+      case Mode::FLOYD_STEINBERG:
+        return "floyd-steinberg";
+      case Mode::ATKINSON:
+        return "atkinson";
+      case Mode::BAYER:
+        return "bayer";
+      default:
+        return "none";
+    }
+  }
+
+  void begin(Mode mode, uint32_t width) {
+    _mode = mode;
+    _width = width;
+    _currentY = 0;
+
+    std::size_t rows = 0;
+    if (mode == Mode::FLOYD_STEINBERG) rows = 2;
+    if (mode == Mode::ATKINSON) rows = 3;
+
+    _errors.assign(rows, std::vector<int16_t>(width + 2 * rowPadding, 0));
+  }
+
+  void end() {
+    _errors.clear();
+    _errors.shrink_to_fit();
+  }
+
+  Mode mode() const {
+    return _mode;
+  }
+
+  // returns gray level 0..15
+  uint8_t quantize(uint32_t x, uint32_t y, uint8_t gray) {
+    switch (_mode) {
+      case Mode::NONE:
+        return gray >> 4;
+
+      case Mode::BAYER: {
+        // threshold offset spans one gray level step centered around 0
+        const int offset = ((bayer4[y & 3][x & 3] * 2 + 1) * levelStep) / 32 - levelStep / 2;
+        return toLevel(gray + offset);
+      }
+
+      case Mode::FLOYD_STEINBERG:
+      case Mode::ATKINSON:
+        return diffuse(x, y, gray);
+    }
+    return gray >> 4;
+  }
+
+private:
+  static uint8_t toLevel(int value) {
+    return static_cast<uint8_t>((std::clamp(value, 0, 255) + levelStep / 2) / levelStep);
+  }
+
+  uint8_t diffuse(uint32_t x, uint32_t y, uint8_t gray) {
+    const std::size_t rows = _errors.size();
+    while (_currentY < y) {
+      // current row is done, its slot becomes the furthest row ahead
+      auto& row = _errors[_currentY % rows];
+      std::fill(row.begin(), row.end(), 0);
+      _currentY++;
+    }
+
+    const std::size_t i = x + rowPadding;
+    auto& current = _errors[y % rows];
+    auto& next = _errors[(y + 1) % rows];
+
+    const int value = gray + current[i];
+    const uint8_t level = toLevel(value);
+    const int error = value - level * levelStep;
+
+    if (_mode == Mode::FLOYD_STEINBERG) {
+      current[i + 1] += error * 7 / 16;
+      next[i - 1] += error * 3 / 16;
+      next[i] += error * 5 / 16;
+      next[i + 1] += error / 16;
+    } else {
+      // Atkinson diffuses only 6/8 of the error, which keeps highlights and shadows clean
+      auto& afterNext = _errors[(y + 2) % rows];
+      const int part = error / 8;
+      current[i + 1] += part;
+      current[i + 2] += part;
+      next[i - 1] += part;
+      next[i] += part;
+      next[i + 1] += part;
+      afterNext[i] += part;
+    }
+
+    return level;
+  }
+};
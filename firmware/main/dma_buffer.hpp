@@ -1,5 +1,6 @@
 #pragma once
 
+#include "arena.hpp"
 #include "esp_heap_caps.h"
 
 #include <vector>
@@ -12,12 +13,13 @@ struct DmaAllocator {
   template<class U>
   DmaAllocator(const DmaAllocator<U>&) noexcept {};
 
+  // NOTE DMA arena is reserved for display buffers, heap is used only when they don't fit
   T* allocate(std::size_t n) {
-    return reinterpret_cast<T*>(heap_caps_malloc(n * sizeof(T), MALLOC_CAP_DMA));
+    return reinterpret_cast<T*>(dmaArena().allocateOrHeap(n * sizeof(T), MALLOC_CAP_DMA));
   }
 
   void deallocate(T* p, std::size_t n) {
-    heap_caps_free(p);
+    dmaArena().releaseOrHeap(p);
   }
 };
 
@@ -33,12 +35,16 @@ constexpr bool operator!=(const DmaAllocator<T>&, const DmaAllocator<U>&) noexce
 
 using DmaBuffer = std::vector<uint8_t, DmaAllocator<uint8_t>>;
 
-template<std::size_t size>
-static DmaBuffer make_dma_buffer() {
-  static_assert(size % 4 == 0, "DMA buffer size must be multiple of 4");
-
+static DmaBuffer make_dma_buffer(std::size_t size) {
   DmaBuffer buffer{};
   buffer.resize(size);
 
   return buffer;
 }
+
+template<std::size_t size>
+static DmaBuffer make_dma_buffer() {
+  static_assert(size % 4 == 0, "DMA buffer size must be multiple of 4");
+
+  return make_dma_buffer(size);
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Anti-aliased bitmap font. Glyphs are 4bpp coverage bitmaps (15 = full ink) in an atlas stored in flash, generated
+// from BMFont by firmware/tools/fontAtlas.js. Every glyph row starts on whole byte, left pixel in high nibble.
+struct Font {
+  struct Glyph {
+    uint32_t codepoint;
+    uint32_t offset; // of the first glyph byte in atlas
+    uint8_t width;
+    uint8_t height;
+    int8_t xOffset;
+    int8_t yOffset; // from the top of the line
+    uint8_t advance;
+  };
+
+  uint8_t lineHeight;
+  uint8_t baseline;
+  const Glyph* glyphs; // sorted by codepoint
+  std::size_t glyphCount;
+  const uint8_t* atlas;
+
+  const Glyph* find(uint32_t codepoint) const {
+    const Glyph* end = glyphs + glyphCount;
+    const Glyph* it =
+      std::lower_bound(glyphs, end, codepoint, [](const Glyph& glyph, uint32_t cp) { return glyph.codepoint < cp; });
+    return it != end && it->codepoint == codepoint ? it : nullptr;
+  }
+
+  uint8_t coverage(const Glyph& glyph, uint32_t x, uint32_t y) const {
+    const uint8_t byte = atlas[glyph.offset + y * ((glyph.width + 1) / 2) + x / 2];
+    return (x % 2) == 0 ? byte >> 4 : byte & 0x0f;
+  }
+};
+
+// returns next code point of UTF-8 text and moves i behind it, malformed sequences are replaced by U+FFFD
+inline uint32_t decodeUtf8(std::string_view text, std::size_t& i) {
+  constexpr uint32_t replacement = 0xfffd;
+
+  const uint8_t lead = text[i++];
+  if (lead < 0x80) return lead;
+
+  std::size_t length = 0;
+  uint32_t codepoint = 0;
+  if ((lead & 0xe0) == 0xc0) {
+    length = 1;
+    codepoint = lead & 0x1f;
+  } else if ((lead & 0xf0) == 0xe0) {
+    length = 2;
+    codepoint = lead & 0x0f;
+  } else if ((lead & 0xf8) == 0xf0) {
+    length = 3;
+    codepoint = lead & 0x07;
+  } else {
+    return replacement;
+  }
+
+  for (std::size_t n = 0; n < length; n++) {
+    if (i >= text.size() || (static_cast<uint8_t>(text[i]) & 0xc0) != 0x80) return replacement;
+    codepoint = (codepoint << 6) | (static_cast<uint8_t>(text[i++]) & 0x3f);
+  }
+  return codepoint;
+}
+
+// Text laid out once (UTF-8 decoding and glyph lookup), then blended into every strip it crosses.
+struct TextOverlay {
+  struct PlacedGlyph {
+    int32_t x;
+    int32_t y;
+    const Font::Glyph* glyph;
+  };
+
+  const Font* font;
+  uint8_t level; // 0 black .. 15 white
+  uint8_t scale{1}; // glyph pixels are enlarged to scale x scale blocks
+  std::vector<PlacedGlyph> glyphs{};
+  int32_t width{};
+
+  // x, y: top left corner of the line
+  static TextOverlay layout(
+    const Font& font, std::string_view text, int32_t x, int32_t y, uint8_t level = 0, uint8_t scale = 1) {
+    TextOverlay overlay{&font, level, scale};
+    const Font::Glyph* fallback = font.find('?');
+
+    int32_t penX = x;
+    std::size_t i = 0;
+    while (i < text.size()) {
+      const Font::Glyph* glyph = font.find(decodeUtf8(text, i));
+      if (glyph == nullptr) glyph = fallback;
+      if (glyph == nullptr) continue;
+
+      if (glyph->width > 0) {
+        overlay.glyphs.push_back({penX + glyph->xOffset * scale, y + glyph->yOffset * scale, glyph});
+      }
+      penX += glyph->advance * scale;
+    }
+    overlay.width = penX - x;
+    return overlay;
+  }
+
+  void translate(int32_t dx, int32_t dy) {
+    for (auto& placed : glyphs) {
+      placed.x += dx;
+      placed.y += dy;
+    }
+  }
+};
+
+// blends anti-aliased text into strip of packed 4bpp rows placed at x, y on the display
+template<typename Texts>
+void blendText(const Texts& texts, uint8_t* strip, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+  const uint32_t rowSize = width / 2;
+  const int32_t stripLeft = x;
+  const int32_t stripTop = y;
+  const int32_t stripRight = x + width;
+  const int32_t stripBottom = y + height;
+
+  for (const TextOverlay& text : texts) {
+    const int32_t scale = text.scale;
+    for (const auto& placed : text.glyphs) {
+      const Font::Glyph& glyph = *placed.glyph;
+      const int32_t top = std::max(stripTop, placed.y);
+      const int32_t bottom = std::min(stripBottom, placed.y + glyph.height * scale);
+      const int32_t left = std::max(stripLeft, placed.x);
+      const int32_t right = std::min(stripRight, placed.x + glyph.width * scale);
+
+      for (int32_t row = top; row < bottom; row++) {
+        for (int32_t column = left; column < right; column++) {
+          const uint8_t coverage = text.font->coverage(glyph, (column - placed.x) / scale, (row - placed.y) / scale);
+          if (coverage == 0) continue;
+
+          const uint32_t i = column - stripLeft;
+          uint8_t& byte = strip[(row - stripTop) * rowSize + i / 2];
+          const int background = (i % 2) == 0 ? byte >> 4 : byte & 0x0f;
+          const uint8_t level = background + ((text.level - background) * coverage) / 15;
+          byte = (i % 2) == 0 ? (byte & 0x0f) | (level << 4) : (byte & 0xf0) | level;
+        }
+      }
+    }
+  }
+}
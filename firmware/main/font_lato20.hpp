@@ -0,0 +1,602 @@
+#pragma once
+
+#include "font.hpp"
+
+// Generated by firmware/tools/fontAtlas.js from Lato-Regular-20.fnt, do not edit.
+namespace fonts {
+namespace lato20_data {
+inline constexpr Font::Glyph glyphs[] = {
+  {0x20, 0, 0, 0, 0, 20, 4},
+  {0x21, 0, 3, 14, 2, 6, 7},
+  {0x22, 28, 6, 5, 1, 6, 8},
+  {0x23, 43, 12, 14, 0, 6, 12},
+  {0x24, 127, 10, 18, 1, 4, 12},
+  {0x25, 217, 15, 14, 0, 6, 16},
+  {0x26, 329, 14, 14, 0, 6, 14},
+  {0x27, 427, 3, 5, 1, 6, 5},
+  {0x28, 437, 5, 19, 1, 4, 6},
+  {0x29, 494, 5, 19, 0, 4, 6},
+  {0x2a, 551, 7, 7, 0, 6, 8},
+  {0x2b, 579, 10, 10, 1, 8, 12},
+  {0x2c, 629, 4, 6, 0, 17, 4},
+  {0x2d, 641, 5, 3, 1, 13, 7},
+  {0x2e, 650, 4, 3, 0, 17, 4},
+  {0x2f, 656, 9, 15, -1, 6, 7},
+  {0x30, 731, 11, 14, 0, 6, 12},
+  {0x31, 815, 9, 14, 2, 6, 12},
+  {0x32, 885, 10, 14, 1, 6, 12},
+  {0x33, 955, 10, 14, 1, 6, 12},
+  {0x34, 1025, 12, 14, 0, 6, 12},
+  {0x35, 1109, 10, 14, 1, 6, 12},
+  {0x36, 1179, 10, 14, 1, 6, 12},
+  {0x37, 1249, 10, 14, 1, 6, 12},
+  {0x38, 1319, 11, 14, 0, 6, 12},
+  {0x39, 1403, 10, 14, 1, 6, 12},
+  {0x3a, 1473, 3, 10, 1, 10, 5},
+  {0x3b, 1493, 3, 13, 1, 10, 5},
+  {0x3c, 1519, 9, 9, 1, 9, 12},
+  {0x3d, 1564, 10, 6, 1, 10, 12},
+  {0x3e, 1594, 9, 9, 2, 9, 12},
+  {0x3f, 1639, 8, 14, 0, 6, 8},
+  {0x40, 1695, 16, 16, 0, 7, 16},
+  {0x41, 1823, 14, 14, 0, 6, 14},
+  {0x42, 1921, 11, 14, 1, 6, 13},
+  {0x43, 2005, 13, 14, 0, 6, 14},
+  {0x44, 2103, 14, 14, 1, 6, 15},
+  {0x45, 2201, 10, 14, 1, 6, 12},
+  {0x46, 2271, 10, 14, 1, 6, 11},
+  {0x47, 2341, 14, 14, 0, 6, 15},
+  {0x48, 2439, 13, 14, 1, 6, 15},
+  {0x49, 2537, 3, 14, 2, 6, 6},
+  {0x4a, 2565, 8, 14, 0, 6, 9},
+  {0x4b, 2621, 13, 14, 1, 6, 14},
+  {0x4c, 2719, 9, 14, 1, 6, 10},
+  {0x4d, 2789, 16, 14, 1, 6, 18},
+  {0x4e, 2901, 13, 14, 1, 6, 15},
+  {0x4f, 2999, 16, 14, 0, 6, 16},
+  {0x50, 3111, 11, 14, 1, 6, 12},
+  {0x51, 3195, 16, 17, 0, 6, 16},
+  {0x52, 3331, 12, 14, 1, 6, 13},
+  {0x53, 3415, 10, 14, 0, 6, 11},
+  {0x54, 3485, 12, 14, 0, 6, 12},
+  {0x55, 3569, 13, 14, 1, 6, 15},
+  {0x56, 3667, 14, 14, 0, 6, 14},
+  {0x57, 3765, 21, 14, 0, 6, 20},
+  {0x58, 3919, 13, 14, 0, 6, 13},
+  {0x59, 4017, 13, 14, 0, 6, 13},
+  {0x5a, 4115, 12, 14, 0, 6, 12},
+  {0x5b, 4199, 5, 19, 1, 5, 6},
+  {0x5c, 4256, 9, 15, -1, 6, 8},
+  {0x5d, 4331, 5, 19, 0, 5, 6},
+  {0x5e, 4388, 9, 7, 1, 5, 12},
+  {0x5f, 4423, 8, 2, 0, 22, 8},
+  {0x60, 4431, 5, 3, 0, 6, 6},
+  {0x61, 4440, 9, 10, 0, 10, 10},
+  {0x62, 4490, 10, 14, 1, 6, 11},
+  {0x63, 4560, 9, 10, 0, 10, 9},
+  {0x64, 4610, 10, 14, 0, 6, 11},
+  {0x65, 4680, 10, 10, 0, 10, 10},
+  {0x66, 4730, 7, 14, 0, 6, 7},
+  {0x67, 4786, 10, 13, 0, 10, 10},
+  {0x68, 4851, 9, 14, 1, 6, 11},
+  {0x69, 4921, 3, 14, 1, 6, 5},
+  {0x6a, 4949, 5, 17, -1, 6, 5},
+  {0x6b, 5000, 10, 14, 1, 6, 10},
+  {0x6c, 5070, 3, 14, 1, 6, 5},
+  {0x6d, 5098, 15, 10, 1, 10, 16},
+  {0x6e, 5178, 9, 10, 1, 10, 11},
+  {0x6f, 5228, 11, 10, 0, 10, 11},
+  {0x70, 5288, 10, 13, 1, 10, 11},
+  {0x71, 5353, 10, 13, 0, 10, 11},
+  {0x72, 5418, 7, 10, 1, 10, 8},
+  {0x73, 5458, 8, 10, 0, 10, 9},
+  {0x74, 5498, 7, 13, 0, 7, 7},
+  {0x75, 5550, 9, 10, 1, 10, 11},
+  {0x76, 5600, 11, 10, 0, 10, 10},
+  {0x77, 5660, 16, 10, 0, 10, 15},
+  {0x78, 5740, 10, 10, 0, 10, 10},
+  {0x79, 5790, 11, 13, 0, 10, 10},
+  {0x7a, 5868, 9, 10, 0, 10, 9},
+  {0x7b, 5918, 6, 19, 0, 5, 6},
+  {0x7c, 5975, 2, 18, 2, 5, 6},
+  {0x7d, 5993, 6, 19, 0, 5, 6},
+  {0x7e, 6050, 10, 4, 1, 12, 12},
+  {0xb0, 6070, 8, 7, 0, 6, 8},
+  {0xc1, 6098, 14, 18, 0, 2, 14},
+  {0xc9, 6224, 10, 18, 1, 2, 12},
+  {0xcd, 6314, 6, 18, 1, 2, 6},
+  {0xd3, 6368, 16, 18, 0, 2, 16},
+  {0xda, 6512, 13, 18, 1, 2, 15},
+  {0xdd, 6638, 13, 18, 0, 2, 13},
+  {0xe1, 6764, 9, 14, 0, 6, 10},
+  {0xe9, 6834, 10, 14, 0, 6, 10},
+  {0xed, 6904, 5, 14, 1, 6, 5},
+  {0xf3, 6946, 11, 14, 0, 6, 11},
+  {0xfa, 7030, 9, 14, 1, 6, 11},
+  {0xfd, 7100, 11, 17, 0, 6, 10},
+  {0x160, 7202, 10, 17, 0, 3, 11},
+  {0x161, 7287, 8, 14, 0, 6, 9},
+  {0x17d, 7343, 12, 17, 0, 3, 12},
+  {0x17e, 7445, 9, 14, 0, 6, 9},
+};
+
+inline constexpr uint8_t atlas[] = {
+  0x6f, 0x40, 0x6f, 0x40, 0x6f, 0x40, 0x6f, 0x40, 0x6f, 0x40, 0x6f, 0x40, 0x6f, 0x40, 0x5f, 0x30,
+  0x3f, 0x20, 0x01, 0x00, 0x00, 0x00, 0x26, 0x10, 0xbf, 0x90, 0x8e, 0x50, 0x7f, 0x12, 0xf6, 0x7f,
+  0x12, 0xf6, 0x7f, 0x12, 0xf6, 0x6f, 0x01, 0xf5, 0x3c, 0x00, 0xd2, 0x00, 0x00, 0xab, 0x00, 0xc8,
+  0x00, 0x00, 0x00, 0xe8, 0x01, 0xf7, 0x00, 0x00, 0x03, 0xf4, 0x04, 0xf4, 0x00, 0x00, 0x06, 0xf1,
+  0x07, 0xf1, 0x00, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x04, 0x4c, 0xc4, 0x4d, 0xb4, 0x20, 0x00,
+  0x0d, 0x90, 0x0e, 0x80, 0x00, 0x00, 0x1f, 0x60, 0x2f, 0x50, 0x00, 0x00, 0x4f, 0x40, 0x5f, 0x30,
+  0x00, 0x6f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x13, 0xad, 0x33, 0xbd, 0x33, 0x10, 0x00, 0xca, 0x00,
+  0xd9, 0x00, 0x00, 0x01, 0xf7, 0x01, 0xf6, 0x00, 0x00, 0x04, 0xe2, 0x03, 0xf3, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0x30, 0x00, 0x00, 0x00, 0x0f, 0x20, 0x00, 0x00, 0x4b, 0xef, 0xd9, 0x20, 0x07, 0xfd,
+  0x9f, 0x9e, 0xe1, 0x1f, 0xb0, 0x3e, 0x01, 0x40, 0x4f, 0x60, 0x4d, 0x00, 0x00, 0x3f, 0xa0, 0x5c,
+  0x00, 0x00, 0x0c, 0xfa, 0x9b, 0x00, 0x00, 0x02, 0xaf, 0xfe, 0x93, 0x00, 0x00, 0x02, 0xbe, 0xff,
+  0x80, 0x00, 0x00, 0x97, 0x3c, 0xf5, 0x00, 0x00, 0xa6, 0x03, 0xf8, 0x00, 0x00, 0xc5, 0x03, 0xf8,
+  0x68, 0x10, 0xd4, 0x0a, 0xf3, 0x9f, 0xe9, 0xe9, 0xcf, 0x80, 0x04, 0xbe, 0xff, 0xc5, 0x00, 0x00,
+  0x01, 0xf1, 0x00, 0x00, 0x00, 0x02, 0xe0, 0x00, 0x00, 0x01, 0xae, 0xd8, 0x00, 0x00, 0x02, 0xda,
+  0x00, 0x0b, 0xc3, 0x4e, 0x70, 0x00, 0x0c, 0xc1, 0x00, 0x2f, 0x40, 0x07, 0xd0, 0x00, 0x8e, 0x20,
+  0x00, 0x4f, 0x20, 0x05, 0xf0, 0x05, 0xf5, 0x00, 0x00, 0x2f, 0x40, 0x07, 0xe0, 0x2e, 0x90, 0x00,
+  0x00, 0x0b, 0xb1, 0x2d, 0x71, 0xcc, 0x00, 0x00, 0x00, 0x01, 0xae, 0xe8, 0x09, 0xe2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0x41, 0xae, 0xd7, 0x00, 0x00, 0x00, 0x03, 0xe8, 0x0c, 0xc3, 0x5e,
+  0x60, 0x00, 0x00, 0x1d, 0xb0, 0x3f, 0x30, 0x09, 0xc0, 0x00, 0x00, 0xae, 0x10, 0x5f, 0x10, 0x06,
+  0xe0, 0x00, 0x07, 0xf4, 0x00, 0x3f, 0x20, 0x08, 0xd0, 0x00, 0x3f, 0x70, 0x00, 0x0c, 0xa1, 0x3e,
+  0x60, 0x01, 0xda, 0x00, 0x00, 0x02, 0xae, 0xd7, 0x00, 0x00, 0x00, 0x6d, 0xfd, 0x70, 0x00, 0x00,
+  0x00, 0x09, 0xfa, 0x69, 0xf9, 0x00, 0x00, 0x00, 0x2f, 0xa0, 0x00, 0x8f, 0x10, 0x00, 0x00, 0x3f,
+  0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0x60, 0x00, 0x02, 0x10, 0x01, 0xce, 0x5c, 0xf6, 0x00, 0x3f,
+  0x50, 0x0a, 0xf3, 0x01, 0xcf, 0x60, 0x6f, 0x20, 0x1f, 0xb0, 0x00, 0x1c, 0xf6, 0xcc, 0x00, 0x2f,
+  0xb0, 0x00, 0x01, 0xcf, 0xf5, 0x00, 0x0e, 0xe2, 0x00, 0x00, 0x6f, 0xf7, 0x00, 0x04, 0xfd, 0x64,
+  0x6b, 0xf9, 0xbf, 0x70, 0x00, 0x3a, 0xef, 0xd9, 0x30, 0x0a, 0xf7, 0x7f, 0x10, 0x7f, 0x10, 0x7f,
+  0x10, 0x6f, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x10, 0x00, 0xcc, 0x00, 0x05, 0xf5,
+  0x00, 0x0b, 0xe0, 0x00, 0x1f, 0x80, 0x00, 0x4f, 0x50, 0x00, 0x7f, 0x10, 0x00, 0x9f, 0x00, 0x00,
+  0xae, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x7f, 0x20, 0x00, 0x4f, 0x50, 0x00, 0x0e,
+  0xa0, 0x00, 0x09, 0xe1, 0x00, 0x03, 0xf7, 0x00, 0x00, 0xae, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+  0x00, 0x2d, 0x20, 0x00, 0x1e, 0xa0, 0x00, 0x07, 0xf3, 0x00, 0x01, 0xf8, 0x00, 0x00, 0xae, 0x00,
+  0x00, 0x6f, 0x20, 0x00, 0x3f, 0x50, 0x00, 0x2f, 0x70, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0x70, 0x00,
+  0x2f, 0x60, 0x00, 0x4f, 0x50, 0x00, 0x7f, 0x10, 0x00, 0xcd, 0x00, 0x02, 0xf7, 0x00, 0x09, 0xf2,
+  0x00, 0x2f, 0x80, 0x00, 0x19, 0x10, 0x00, 0x00, 0x07, 0x60, 0x00, 0x09, 0x37, 0x63, 0x80, 0x03,
+  0xcc, 0xcb, 0x30, 0x01, 0x8e, 0xe8, 0x10, 0x0b, 0x77, 0x77, 0xb0, 0x00, 0x07, 0x60, 0x00, 0x00,
+  0x02, 0x20, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xe8,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x11, 0x11, 0xe8, 0x11, 0x11, 0xff, 0xff, 0xff, 0xff,
+  0xf9, 0x44, 0x44, 0xfa, 0x44, 0x42, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00,
+  0x00, 0x00, 0xe8, 0x00, 0x00, 0x02, 0x30, 0x0e, 0xf3, 0x0c, 0xf4, 0x00, 0xd1, 0x08, 0x70, 0x05,
+  0x00, 0x22, 0x22, 0x20, 0xff, 0xff, 0xe0, 0x55, 0x55, 0x50, 0x03, 0x50, 0x1f, 0xf4, 0x0c, 0xe2,
+  0x00, 0x00, 0x00, 0x1d, 0x60, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00,
+  0x00, 0x05, 0xf2, 0x00, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x00,
+  0x9d, 0x00, 0x00, 0x00, 0x01, 0xe7, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x00, 0x00, 0x0c, 0x90,
+  0x00, 0x00, 0x00, 0x4f, 0x30, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00,
+  0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcf, 0xea, 0x30,
+  0x00, 0x00, 0xaf, 0xc8, 0x9e, 0xf4, 0x00, 0x06, 0xf9, 0x00, 0x02, 0xee, 0x10, 0x0d, 0xe1, 0x00,
+  0x00, 0x7f, 0x60, 0x2f, 0xa0, 0x00, 0x00, 0x2f, 0xb0, 0x5f, 0x80, 0x00, 0x00, 0x0e, 0xe0, 0x6f,
+  0x70, 0x00, 0x00, 0x0d, 0xf0, 0x6f, 0x70, 0x00, 0x00, 0x0d, 0xf0, 0x5f, 0x80, 0x00, 0x00, 0x0e,
+  0xe0, 0x2f, 0xa0, 0x00, 0x00, 0x2f, 0xb0, 0x0d, 0xe1, 0x00, 0x00, 0x7f, 0x70, 0x06, 0xf9, 0x00,
+  0x02, 0xee, 0x10, 0x00, 0xaf, 0xc7, 0x8e, 0xf4, 0x00, 0x00, 0x07, 0xcf, 0xea, 0x30, 0x00, 0x00,
+  0x05, 0xfb, 0x00, 0x00, 0x00, 0x7f, 0xfb, 0x00, 0x00, 0x0a, 0xfb, 0xfb, 0x00, 0x00, 0xbf, 0x81,
+  0xfb, 0x00, 0x00, 0x45, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xfb,
+  0x00, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x00,
+  0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x00, 0x00, 0x15, 0x55, 0xfc, 0x55, 0x30,
+  0x2f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x5c, 0xee, 0xc4, 0x00, 0x08, 0xfd, 0x89, 0xef, 0x60, 0x3f,
+  0xb0, 0x00, 0x1e, 0xf1, 0x8f, 0x20, 0x00, 0x09, 0xf4, 0x01, 0x00, 0x00, 0x09, 0xf3, 0x00, 0x00,
+  0x00, 0x0d, 0xe0, 0x00, 0x00, 0x00, 0x8f, 0x60, 0x00, 0x00, 0x05, 0xfa, 0x00, 0x00, 0x00, 0x5f,
+  0xa0, 0x00, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x06, 0xfa, 0x00, 0x00,
+  0x00, 0x7f, 0xe9, 0xaa, 0xaa, 0xa4, 0xef, 0xff, 0xff, 0xff, 0xf9, 0x00, 0x4b, 0xde, 0xc6, 0x00,
+  0x06, 0xfe, 0x98, 0xcf, 0xb0, 0x1f, 0xc1, 0x00, 0x0b, 0xf3, 0x4d, 0x40, 0x00, 0x06, 0xf5, 0x00,
+  0x00, 0x00, 0x09, 0xf2, 0x00, 0x00, 0x12, 0x8f, 0x80, 0x00, 0x00, 0xbf, 0xf8, 0x00, 0x00, 0x00,
+  0x35, 0x9f, 0xb0, 0x00, 0x00, 0x00, 0x07, 0xf7, 0x00, 0x00, 0x00, 0x02, 0xfa, 0xbe, 0x10, 0x00,
+  0x03, 0xf9, 0x6f, 0x90, 0x00, 0x1b, 0xf5, 0x0b, 0xfc, 0x89, 0xdf, 0x90, 0x00, 0x7d, 0xfe, 0xc5,
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf0, 0x00, 0x00, 0x00, 0x09,
+  0xfb, 0xf0, 0x00, 0x00, 0x00, 0x5f, 0x68, 0xf0, 0x00, 0x00, 0x02, 0xea, 0x08, 0xf0, 0x00, 0x00,
+  0x1d, 0xd1, 0x08, 0xf0, 0x00, 0x00, 0xaf, 0x30, 0x08, 0xf0, 0x00, 0x07, 0xf6, 0x00, 0x08, 0xf0,
+  0x00, 0x4f, 0xb1, 0x11, 0x19, 0xf2, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x14, 0x44, 0x44,
+  0x4a, 0xf4, 0x40, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xf0, 0x00, 0x02, 0xff, 0xff, 0xff, 0xc0, 0x04, 0xfa, 0x99, 0x99, 0x40, 0x07,
+  0xf1, 0x00, 0x00, 0x00, 0x0a, 0xd0, 0x00, 0x00, 0x00, 0x0d, 0xa0, 0x11, 0x00, 0x00, 0x0f, 0xef,
+  0xff, 0xc5, 0x00, 0x18, 0x86, 0x58, 0xef, 0x60, 0x00, 0x00, 0x00, 0x2e, 0xe0, 0x00, 0x00, 0x00,
+  0x0b, 0xf2, 0x00, 0x00, 0x00, 0x0a, 0xf3, 0x00, 0x00, 0x00, 0x0d, 0xf1, 0x25, 0x00, 0x00, 0x7f,
+  0x90, 0xaf, 0xc8, 0x8c, 0xfc, 0x10, 0x06, 0xce, 0xfc, 0x70, 0x00, 0x00, 0x00, 0x08, 0xf8, 0x00,
+  0x00, 0x00, 0x6f, 0xa0, 0x00, 0x00, 0x03, 0xec, 0x00, 0x00, 0x00, 0x1d, 0xd1, 0x00, 0x00, 0x00,
+  0xae, 0x20, 0x00, 0x00, 0x06, 0xfc, 0xef, 0xe8, 0x10, 0x1e, 0xf9, 0x55, 0xbf, 0xc0, 0x8f, 0x70,
+  0x00, 0x0a, 0xf6, 0xce, 0x00, 0x00, 0x03, 0xfa, 0xdd, 0x00, 0x00, 0x01, 0xfb, 0xcf, 0x00, 0x00,
+  0x04, 0xf8, 0x7f, 0x80, 0x00, 0x1c, 0xf3, 0x0c, 0xfb, 0x78, 0xdf, 0x70, 0x00, 0x7d, 0xfe, 0xb4,
+  0x00, 0xef, 0xff, 0xff, 0xff, 0xfd, 0x79, 0x99, 0x99, 0x9a, 0xfa, 0x00, 0x00, 0x00, 0x09, 0xf3,
+  0x00, 0x00, 0x00, 0x2f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x30, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00,
+  0x00, 0x0a, 0xf3, 0x00, 0x00, 0x00, 0x3f, 0xa0, 0x00, 0x00, 0x00, 0xbf, 0x30, 0x00, 0x00, 0x03,
+  0xfa, 0x00, 0x00, 0x00, 0x0b, 0xf2, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0xcf, 0x20,
+  0x00, 0x00, 0x05, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x07, 0xdf, 0xeb, 0x30, 0x00, 0x00, 0xbf, 0xa6,
+  0x7d, 0xf5, 0x00, 0x05, 0xf8, 0x00, 0x01, 0xee, 0x00, 0x08, 0xf4, 0x00, 0x00, 0xaf, 0x10, 0x05,
+  0xf6, 0x00, 0x00, 0xde, 0x00, 0x00, 0xce, 0x62, 0x3a, 0xf6, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x60,
+  0x00, 0x02, 0xde, 0x85, 0x6b, 0xf8, 0x00, 0x0b, 0xf4, 0x00, 0x00, 0xaf, 0x40, 0x0f, 0xd0, 0x00,
+  0x00, 0x5f, 0x80, 0x0f, 0xd0, 0x00, 0x00, 0x5f, 0x90, 0x0b, 0xf5, 0x00, 0x00, 0xbf, 0x50, 0x03,
+  0xef, 0x96, 0x7c, 0xfa, 0x00, 0x00, 0x18, 0xdf, 0xec, 0x60, 0x00, 0x00, 0x4a, 0xef, 0xc6, 0x00,
+  0x06, 0xfe, 0x98, 0xcf, 0xb0, 0x2f, 0xd1, 0x00, 0x09, 0xf5, 0x6f, 0x60, 0x00, 0x01, 0xfa, 0x7f,
+  0x50, 0x00, 0x00, 0xfb, 0x5f, 0x90, 0x00, 0x05, 0xfa, 0x0c, 0xf7, 0x22, 0x6e, 0xf6, 0x02, 0xbf,
+  0xff, 0xcf, 0xd0, 0x00, 0x02, 0x42, 0xaf, 0x40, 0x00, 0x00, 0x06, 0xf8, 0x00, 0x00, 0x00, 0x3f,
+  0xc0, 0x00, 0x00, 0x01, 0xde, 0x20, 0x00, 0x00, 0x0b, 0xf6, 0x00, 0x00, 0x00, 0x8f, 0x90, 0x00,
+  0x00, 0x6e, 0x60, 0xaf, 0xa0, 0x16, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+  0x10, 0x9f, 0xa0, 0x6e, 0x70, 0x6e, 0x60, 0xaf, 0xa0, 0x16, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x8f, 0x90, 0x6f, 0xb0, 0x08, 0x60, 0x3c, 0x00, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x20, 0x00, 0x00, 0x06, 0xdf, 0x20, 0x00, 0x06, 0xdf, 0x92, 0x00, 0x06, 0xdf,
+  0x92, 0x00, 0x00, 0x7f, 0xe4, 0x00, 0x00, 0x00, 0x05, 0xdf, 0xa3, 0x00, 0x00, 0x00, 0x05, 0xdf,
+  0xa3, 0x00, 0x00, 0x00, 0x05, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x06, 0x20, 0x01, 0x11, 0x11, 0x11,
+  0x10, 0x8f, 0xff, 0xff, 0xff, 0xf1, 0x24, 0x44, 0x44, 0x44, 0x40, 0x01, 0x11, 0x11, 0x11, 0x10,
+  0x8f, 0xff, 0xff, 0xff, 0xf1, 0x24, 0x44, 0x44, 0x44, 0x40, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xb3, 0x00, 0x00, 0x00, 0x05, 0xcf, 0xb3, 0x00, 0x00, 0x00, 0x05, 0xcf, 0xb3, 0x00, 0x00, 0x00,
+  0x09, 0xff, 0x10, 0x00, 0x06, 0xdf, 0xa2, 0x00, 0x06, 0xdf, 0xa2, 0x00, 0x00, 0x9f, 0xa2, 0x00,
+  0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x06, 0xce, 0xea, 0x30, 0x7f, 0xa7, 0x8e, 0xe2, 0x13,
+  0x00, 0x04, 0xf8, 0x00, 0x00, 0x02, 0xf8, 0x00, 0x00, 0x08, 0xf4, 0x00, 0x00, 0x8f, 0x80, 0x00,
+  0x0b, 0xe5, 0x00, 0x00, 0x2f, 0x70, 0x00, 0x00, 0x1f, 0x40, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x10, 0x00, 0x00, 0x9f, 0xa0, 0x00, 0x00, 0x6e, 0x70, 0x00, 0x00,
+  0x00, 0x04, 0xad, 0xed, 0xb6, 0x10, 0x00, 0x00, 0x02, 0xce, 0x84, 0x34, 0x6c, 0xd4, 0x00, 0x00,
+  0x2e, 0x91, 0x00, 0x00, 0x00, 0x6e, 0x40, 0x01, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xd0, 0x06,
+  0xe1, 0x00, 0x17, 0xce, 0xd9, 0x00, 0xe5, 0x0d, 0x80, 0x02, 0xdd, 0x52, 0xc9, 0x00, 0xb8, 0x1f,
+  0x40, 0x0b, 0xd1, 0x00, 0xe5, 0x00, 0xa9, 0x2f, 0x30, 0x2f, 0x50, 0x04, 0xf1, 0x00, 0xc8, 0x1f,
+  0x40, 0x4f, 0x20, 0x09, 0xd0, 0x02, 0xf3, 0x0d, 0x70, 0x2f, 0x60, 0x5e, 0xe1, 0x1c, 0xa0, 0x09,
+  0xc0, 0x08, 0xff, 0xc2, 0xcf, 0xf9, 0x10, 0x02, 0xf6, 0x00, 0x11, 0x00, 0x02, 0x10, 0x00, 0x00,
+  0x6f, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x05, 0xeb, 0x52, 0x00, 0x14, 0x8e, 0x50, 0x00,
+  0x00, 0x18, 0xdf, 0xff, 0xfe, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0x9e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x49, 0xf3, 0x00, 0x00, 0x00, 0x01, 0xed, 0x04, 0xfa,
+  0x00, 0x00, 0x00, 0x06, 0xf7, 0x00, 0xdf, 0x10, 0x00, 0x00, 0x0d, 0xf2, 0x00, 0x7f, 0x70, 0x00,
+  0x00, 0x4f, 0xa0, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0xaf, 0x61, 0x11, 0x1b, 0xf4, 0x00, 0x01, 0xff,
+  0xff, 0xff, 0xff, 0xfa, 0x00, 0x07, 0xf9, 0x44, 0x44, 0x44, 0xdf, 0x20, 0x0d, 0xf2, 0x00, 0x00,
+  0x00, 0x7f, 0x80, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x09,
+  0xf5, 0x4f, 0xff, 0xff, 0xeb, 0x60, 0x00, 0x4f, 0xd7, 0x78, 0x9e, 0xfa, 0x00, 0x4f, 0xa0, 0x00,
+  0x01, 0xdf, 0x30, 0x4f, 0xa0, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0xcf, 0x20, 0x4f,
+  0xb1, 0x12, 0x4a, 0xf6, 0x00, 0x4f, 0xff, 0xff, 0xfe, 0x60, 0x00, 0x4f, 0xc4, 0x44, 0x59, 0xfb,
+  0x10, 0x4f, 0xa0, 0x00, 0x00, 0x7f, 0x80, 0x4f, 0xa0, 0x00, 0x00, 0x2f, 0xc0, 0x4f, 0xa0, 0x00,
+  0x00, 0x3f, 0xc0, 0x4f, 0xa0, 0x00, 0x00, 0xaf, 0x70, 0x4f, 0xd8, 0x88, 0x9d, 0xfc, 0x10, 0x4f,
+  0xff, 0xff, 0xec, 0x70, 0x00, 0x00, 0x00, 0x29, 0xde, 0xfd, 0x93, 0x00, 0x00, 0x08, 0xff, 0xda,
+  0xac, 0xff, 0x70, 0x00, 0x8f, 0xd4, 0x00, 0x00, 0x2a, 0x50, 0x03, 0xfe, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x3c, 0x70, 0x00, 0x1a, 0xff, 0xca, 0xac, 0xfe, 0x40,
+  0x00, 0x00, 0x4a, 0xdf, 0xec, 0x81, 0x00, 0x4f, 0xff, 0xff, 0xed, 0x94, 0x00, 0x00, 0x4f, 0xd8,
+  0x88, 0x9b, 0xff, 0x90, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x2b, 0xfa, 0x00, 0x4f, 0xa0, 0x00, 0x00,
+  0x00, 0xcf, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xb0, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x0f,
+  0xf0, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x0d, 0xf2, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x0d, 0xf2, 0x4f,
+  0xa0, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xb0, 0x4f, 0xa0, 0x00,
+  0x00, 0x00, 0xcf, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x1b, 0xfa, 0x00, 0x4f, 0xd8, 0x88, 0x8b, 0xef,
+  0xa0, 0x00, 0x4f, 0xff, 0xff, 0xfd, 0x94, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xd8,
+  0x88, 0x88, 0x85, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00,
+  0x00, 0x00, 0x4f, 0xb2, 0x22, 0x22, 0x10, 0x4f, 0xff, 0xff, 0xff, 0x40, 0x4f, 0xc5, 0x55, 0x55,
+  0x10, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00,
+  0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xd8, 0x88, 0x88, 0x84, 0x4f, 0xff, 0xff, 0xff, 0xf8, 0x4f,
+  0xff, 0xff, 0xff, 0xf8, 0x4f, 0xd8, 0x88, 0x88, 0x85, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0,
+  0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xd8, 0x88,
+  0x88, 0x40, 0x4f, 0xff, 0xff, 0xff, 0x80, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00,
+  0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00,
+  0x4f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xce, 0xfd, 0xa5, 0x00, 0x00, 0x08, 0xff, 0xda,
+  0xac, 0xff, 0xc1, 0x00, 0x9f, 0xd4, 0x00, 0x00, 0x17, 0x90, 0x04, 0xfd, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xe0, 0x00, 0x00, 0x02, 0x22, 0x21, 0x1f, 0xe0, 0x00, 0x00, 0x0e, 0xff, 0xf7, 0x0e, 0xf1, 0x00,
+  0x00, 0x04, 0x58, 0xf7, 0x0a, 0xf5, 0x00, 0x00, 0x00, 0x05, 0xf7, 0x03, 0xfd, 0x10, 0x00, 0x00,
+  0x05, 0xf7, 0x00, 0x8f, 0xc2, 0x00, 0x00, 0x07, 0xf7, 0x00, 0x08, 0xff, 0xb9, 0x8a, 0xdf, 0xe4,
+  0x00, 0x00, 0x39, 0xde, 0xfe, 0xb7, 0x10, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0,
+  0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00,
+  0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xb1, 0x11, 0x11, 0x11, 0x9f,
+  0x50, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x4f, 0xc4, 0x44, 0x44, 0x44, 0xbf, 0x50, 0x4f,
+  0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00,
+  0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00,
+  0x9f, 0x50, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x9f, 0x50, 0xef, 0x10, 0xef, 0x10, 0xef, 0x10, 0xef,
+  0x10, 0xef, 0x10, 0xef, 0x10, 0xef, 0x10, 0xef, 0x10, 0xef, 0x10, 0xef, 0x10, 0xef, 0x10, 0xef,
+  0x10, 0xef, 0x10, 0xef, 0x10, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0c,
+  0xf2, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0c,
+  0xf2, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0c, 0xf2, 0x00, 0x00, 0x0d, 0xf1, 0x00, 0x00, 0x1f,
+  0xe0, 0x00, 0x00, 0xaf, 0xa0, 0x3b, 0xce, 0xfe, 0x20, 0x4e, 0xfe, 0xa2, 0x00, 0x1f, 0xd0, 0x00,
+  0x00, 0x09, 0xf8, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x9f, 0x90, 0x00, 0x1f, 0xd0, 0x00, 0x08, 0xfa,
+  0x00, 0x00, 0x1f, 0xd0, 0x00, 0x7f, 0xa0, 0x00, 0x00, 0x1f, 0xd0, 0x07, 0xfb, 0x00, 0x00, 0x00,
+  0x1f, 0xd2, 0x7f, 0xc1, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x30, 0x00, 0x00, 0x00, 0x1f, 0xe5,
+  0x8f, 0xd2, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x08, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0xaf,
+  0xa0, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x0c, 0xf7, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x01, 0xdf, 0x50,
+  0x00, 0x1f, 0xd0, 0x00, 0x00, 0x3e, 0xe3, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x04, 0xed, 0x10, 0x4f,
+  0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0,
+  0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00,
+  0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00,
+  0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xd9, 0x99, 0x99, 0x80,
+  0x4f, 0xff, 0xff, 0xff, 0xd0, 0x4f, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfa, 0x4f, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x2f, 0xfa, 0x4f, 0xff, 0x20, 0x00, 0x00, 0x00, 0xaf, 0xfa, 0x4f, 0xaf, 0xa0,
+  0x00, 0x00, 0x04, 0xfa, 0xfa, 0x4f, 0x7a, 0xf4, 0x00, 0x00, 0x0c, 0xe2, 0xfa, 0x4f, 0x72, 0xec,
+  0x00, 0x00, 0x6f, 0x71, 0xfa, 0x4f, 0x70, 0x8f, 0x60, 0x01, 0xdd, 0x11, 0xfa, 0x4f, 0x70, 0x1d,
+  0xe1, 0x07, 0xf5, 0x01, 0xfa, 0x4f, 0x70, 0x05, 0xf8, 0x2e, 0xc0, 0x01, 0xfa, 0x4f, 0x70, 0x00,
+  0xcf, 0xaf, 0x30, 0x01, 0xfa, 0x4f, 0x70, 0x00, 0x3f, 0xfa, 0x00, 0x01, 0xfa, 0x4f, 0x70, 0x00,
+  0x09, 0xe2, 0x00, 0x01, 0xfa, 0x4f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfa, 0x4f, 0x70, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xfa, 0x4f, 0x80, 0x00, 0x00, 0x00, 0x5f, 0x50, 0x4f, 0xf5, 0x00, 0x00,
+  0x00, 0x5f, 0x50, 0x4f, 0xfe, 0x30, 0x00, 0x00, 0x5f, 0x50, 0x4f, 0xbf, 0xd1, 0x00, 0x00, 0x5f,
+  0x50, 0x4f, 0x78, 0xfa, 0x00, 0x00, 0x5f, 0x50, 0x4f, 0x70, 0xbf, 0x70, 0x00, 0x5f, 0x50, 0x4f,
+  0x70, 0x1d, 0xf4, 0x00, 0x5f, 0x50, 0x4f, 0x70, 0x03, 0xfe, 0x20, 0x5f, 0x50, 0x4f, 0x70, 0x00,
+  0x6f, 0xc1, 0x5f, 0x50, 0x4f, 0x70, 0x00, 0x09, 0xfa, 0x5f, 0x50, 0x4f, 0x70, 0x00, 0x00, 0xcf,
+  0xbf, 0x50, 0x4f, 0x70, 0x00, 0x00, 0x2e, 0xff, 0x50, 0x4f, 0x70, 0x00, 0x00, 0x04, 0xff, 0x50,
+  0x4f, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x50, 0x00, 0x00, 0x39, 0xde, 0xed, 0x92, 0x00, 0x00, 0x00,
+  0x08, 0xff, 0xda, 0xad, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xc3, 0x00, 0x00, 0x3d, 0xf8, 0x00, 0x03,
+  0xfd, 0x10, 0x00, 0x00, 0x01, 0xef, 0x30, 0x0a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x0e,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x1f,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x0a,
+  0xf6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x04, 0xfd, 0x10, 0x00, 0x00, 0x01, 0xdf, 0x30, 0x00,
+  0x9f, 0xc3, 0x00, 0x00, 0x3d, 0xf8, 0x00, 0x00, 0x09, 0xff, 0xca, 0xac, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x39, 0xde, 0xed, 0x93, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xda, 0x40, 0x00, 0x1f, 0xe7, 0x78,
+  0xaf, 0xf7, 0x00, 0x1f, 0xd0, 0x00, 0x03, 0xff, 0x20, 0x1f, 0xd0, 0x00, 0x00, 0x9f, 0x60, 0x1f,
+  0xd0, 0x00, 0x00, 0x7f, 0x70, 0x1f, 0xd0, 0x00, 0x00, 0xaf, 0x60, 0x1f, 0xd0, 0x00, 0x04, 0xfe,
+  0x10, 0x1f, 0xe8, 0x88, 0xbf, 0xf5, 0x00, 0x1f, 0xff, 0xff, 0xd9, 0x30, 0x00, 0x1f, 0xd0, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xde, 0xed,
+  0x92, 0x00, 0x00, 0x00, 0x08, 0xff, 0xda, 0xad, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xc3, 0x00, 0x00,
+  0x3d, 0xf8, 0x00, 0x03, 0xfd, 0x10, 0x00, 0x00, 0x01, 0xef, 0x30, 0x0a, 0xf6, 0x00, 0x00, 0x00,
+  0x00, 0x6f, 0x90, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x0f, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0e, 0xf1, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xd0, 0x0a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x04, 0xfd, 0x10, 0x00, 0x00,
+  0x01, 0xdf, 0x30, 0x00, 0x9f, 0xc3, 0x00, 0x00, 0x3d, 0xf8, 0x00, 0x00, 0x09, 0xff, 0xca, 0xac,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x39, 0xde, 0xed, 0xcf, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2d, 0xf4, 0x1f, 0xff, 0xff, 0xda, 0x30, 0x00, 0x1f, 0xe7, 0x78, 0xbf, 0xf6, 0x00, 0x1f,
+  0xd0, 0x00, 0x04, 0xfe, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0xcf, 0x30, 0x1f, 0xd0, 0x00, 0x00, 0xbf,
+  0x20, 0x1f, 0xd0, 0x00, 0x02, 0xed, 0x00, 0x1f, 0xd1, 0x12, 0x6d, 0xf4, 0x00, 0x1f, 0xff, 0xff,
+  0xfa, 0x30, 0x00, 0x1f, 0xe4, 0x5d, 0xf4, 0x00, 0x00, 0x1f, 0xd0, 0x02, 0xee, 0x20, 0x00, 0x1f,
+  0xd0, 0x00, 0x5f, 0xc0, 0x00, 0x1f, 0xd0, 0x00, 0x09, 0xf9, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0xcf,
+  0x60, 0x1f, 0xd0, 0x00, 0x00, 0x2d, 0xe3, 0x00, 0x18, 0xdf, 0xeb, 0x40, 0x01, 0xdf, 0xc9, 0xae,
+  0xf5, 0x08, 0xf7, 0x00, 0x01, 0x81, 0x0b, 0xf1, 0x00, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0x82, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xc6, 0x00, 0x00, 0x01, 0x6b, 0xff, 0xd1, 0x00,
+  0x00, 0x00, 0x1b, 0xfa, 0x00, 0x00, 0x00, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x1c, 0x60,
+  0x00, 0x09, 0xf7, 0x2d, 0xfd, 0xa9, 0xdf, 0xc1, 0x01, 0x7c, 0xef, 0xc7, 0x00, 0xbf, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x69, 0x99, 0x9f, 0xe9, 0x99, 0x94, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0x00,
+  0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f,
+  0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00,
+  0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00,
+  0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00,
+  0x4f, 0xb0, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x1f, 0xe2, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x08, 0xfc,
+  0x20, 0x00, 0x6e, 0xf3, 0x00, 0x00, 0xaf, 0xfc, 0xad, 0xff, 0x50, 0x00, 0x00, 0x05, 0xbe, 0xfd,
+  0x92, 0x00, 0x00, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x0a, 0xf5, 0x4f, 0xb0, 0x00, 0x00, 0x00, 0x2f,
+  0xd0, 0x0d, 0xf2, 0x00, 0x00, 0x00, 0x8f, 0x70, 0x07, 0xf8, 0x00, 0x00, 0x00, 0xef, 0x10, 0x01,
+  0xfe, 0x00, 0x00, 0x05, 0xfa, 0x00, 0x00, 0x9f, 0x50, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0x3f, 0xc0,
+  0x00, 0x3f, 0xc0, 0x00, 0x00, 0x0c, 0xf3, 0x00, 0x9f, 0x60, 0x00, 0x00, 0x06, 0xf9, 0x01, 0xee,
+  0x10, 0x00, 0x00, 0x00, 0xee, 0x16, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x6c, 0xf2, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0xcf, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xfd, 0x00, 0x00, 0x00, 0xbf, 0x50, 0x00, 0x00, 0x0a, 0xf3, 0x00, 0x00, 0x00, 0xdf, 0x10,
+  0x6f, 0xb0, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x04, 0xfb, 0x00, 0x1f, 0xf1, 0x00, 0x00, 0x6f,
+  0xed, 0x00, 0x00, 0x08, 0xf7, 0x00, 0x0b, 0xf5, 0x00, 0x00, 0xbe, 0x8f, 0x40, 0x00, 0x0d, 0xf2,
+  0x00, 0x06, 0xfa, 0x00, 0x01, 0xf9, 0x3f, 0x90, 0x00, 0x3f, 0xc0, 0x00, 0x02, 0xfe, 0x00, 0x07,
+  0xf4, 0x0d, 0xe0, 0x00, 0x7f, 0x70, 0x00, 0x00, 0xcf, 0x40, 0x0c, 0xe0, 0x08, 0xf4, 0x00, 0xcf,
+  0x20, 0x00, 0x00, 0x7f, 0x80, 0x2f, 0x90, 0x03, 0xf9, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x2f, 0xd0,
+  0x7f, 0x30, 0x00, 0xde, 0x06, 0xf8, 0x00, 0x00, 0x00, 0x0c, 0xf2, 0xcd, 0x00, 0x00, 0x8f, 0x5b,
+  0xf3, 0x00, 0x00, 0x00, 0x08, 0xf9, 0xf8, 0x00, 0x00, 0x3f, 0xae, 0xd0, 0x00, 0x00, 0x00, 0x03,
+  0xff, 0xf3, 0x00, 0x00, 0x0d, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xd0, 0x00, 0x00, 0x07,
+  0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x02, 0xfe, 0x00, 0x00, 0x00, 0x5f,
+  0xd1, 0x00, 0x00, 0x01, 0xdf, 0x30, 0x09, 0xf9, 0x00, 0x00, 0x09, 0xf7, 0x00, 0x01, 0xdf, 0x40,
+  0x00, 0x4f, 0xc0, 0x00, 0x00, 0x4f, 0xd1, 0x01, 0xde, 0x20, 0x00, 0x00, 0x08, 0xf9, 0x0a, 0xf5,
+  0x00, 0x00, 0x00, 0x00, 0xcf, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x6f, 0xff, 0x50, 0x00, 0x00, 0x00, 0x02, 0xed, 0x3f, 0xe1, 0x00, 0x00, 0x00, 0x0c,
+  0xf4, 0x07, 0xfa, 0x00, 0x00, 0x00, 0x7f, 0x90, 0x00, 0xcf, 0x50, 0x00, 0x03, 0xfd, 0x10, 0x00,
+  0x3f, 0xe1, 0x00, 0x0c, 0xf4, 0x00, 0x00, 0x08, 0xfa, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x00, 0xcf,
+  0x50, 0x9f, 0x70, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x1e, 0xe2, 0x00, 0x00, 0x07, 0xf9, 0x00, 0x06,
+  0xfa, 0x00, 0x00, 0x2e, 0xe1, 0x00, 0x00, 0xbf, 0x40, 0x00, 0xaf, 0x50, 0x00, 0x00, 0x2f, 0xd0,
+  0x04, 0xfb, 0x00, 0x00, 0x00, 0x08, 0xf8, 0x0d, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xde, 0x8f, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4,
+  0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x06, 0x88, 0x88, 0x88, 0x8f, 0xf6, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x1e, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0x70, 0x00, 0x00, 0x00, 0x07, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x3f,
+  0xe2, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xc0, 0x00, 0x00, 0x00, 0x02, 0xee, 0x20, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0x88, 0x88, 0x88,
+  0x85, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x8f, 0xff, 0x10, 0x9e, 0x22, 0x00, 0x9e, 0x00, 0x00,
+  0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e,
+  0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00,
+  0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x9f, 0xfe, 0x10, 0x13, 0x33, 0x00,
+  0x1e, 0x50, 0x00, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x00, 0x00,
+  0xbb, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x20, 0x00, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0xe0, 0x00, 0x00, 0x00, 0x01, 0xf6, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x4f,
+  0x30, 0x00, 0x00, 0x00, 0x0c, 0x90, 0x00, 0x00, 0x00, 0x06, 0xf1, 0x00, 0x00, 0x00, 0x01, 0xe7,
+  0x00, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x50, 0x1f, 0xff, 0x80, 0x02, 0x2e,
+  0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90,
+  0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00,
+  0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x00, 0x0e, 0x90, 0x1e, 0xff,
+  0x90, 0x03, 0x33, 0x10, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x06, 0xfd, 0x00, 0x00, 0x00, 0x1e,
+  0xbf, 0x60, 0x00, 0x00, 0x7f, 0x39, 0xe1, 0x00, 0x01, 0xe9, 0x02, 0xf8, 0x00, 0x09, 0xf2, 0x00,
+  0x8e, 0x20, 0x2f, 0x80, 0x00, 0x1d, 0x90, 0xff, 0xff, 0xff, 0xfd, 0x33, 0x33, 0x33, 0x32, 0x3f,
+  0xc0, 0x00, 0x05, 0xf7, 0x00, 0x00, 0x7e, 0x10, 0x00, 0x4a, 0xef, 0xc4, 0x00, 0x05, 0xfc, 0x77,
+  0xcf, 0x40, 0x01, 0x30, 0x00, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x0d, 0xd0, 0x00, 0x17, 0xbd, 0xef,
+  0xe0, 0x04, 0xed, 0x74, 0x2d, 0xe0, 0x0e, 0xd1, 0x00, 0x0d, 0xe0, 0x0f, 0xa0, 0x00, 0x1e, 0xe0,
+  0x0c, 0xe4, 0x15, 0xde, 0xe0, 0x02, 0xbe, 0xeb, 0x37, 0xe0, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x7f,
+  0x50, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x7f, 0x56,
+  0xcf, 0xd8, 0x00, 0x7f, 0xcc, 0x77, 0xdf, 0x80, 0x7f, 0xa0, 0x00, 0x1d, 0xf1, 0x7f, 0x50, 0x00,
+  0x08, 0xf5, 0x7f, 0x50, 0x00, 0x06, 0xf6, 0x7f, 0x50, 0x00, 0x07, 0xf6, 0x7f, 0x50, 0x00, 0x09,
+  0xf4, 0x7f, 0x60, 0x00, 0x2e, 0xe0, 0x7f, 0xd9, 0x68, 0xef, 0x50, 0x7f, 0x3a, 0xee, 0xb4, 0x00,
+  0x00, 0x29, 0xdf, 0xd9, 0x10, 0x02, 0xef, 0x96, 0x8d, 0x90, 0x0b, 0xf5, 0x00, 0x00, 0x00, 0x1f,
+  0xc0, 0x00, 0x00, 0x00, 0x3f, 0x90, 0x00, 0x00, 0x00, 0x3f, 0x90, 0x00, 0x00, 0x00, 0x1f, 0xc0,
+  0x00, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x01, 0x20, 0x02, 0xef, 0x86, 0x8e, 0xb0, 0x00, 0x2a, 0xef,
+  0xd8, 0x10, 0x00, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x02,
+  0xfa, 0x00, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x2a, 0xee, 0xb5, 0xfa, 0x03, 0xef, 0x96, 0x8e, 0xfa,
+  0x0b, 0xf4, 0x00, 0x04, 0xfa, 0x1f, 0xc0, 0x00, 0x02, 0xfa, 0x4f, 0xa0, 0x00, 0x02, 0xfa, 0x4f,
+  0x90, 0x00, 0x02, 0xfa, 0x2f, 0xa0, 0x00, 0x02, 0xfa, 0x0d, 0xf1, 0x00, 0x06, 0xfa, 0x06, 0xfd,
+  0x65, 0x9c, 0xfa, 0x00, 0x6d, 0xfd, 0x81, 0xda, 0x00, 0x29, 0xdf, 0xd8, 0x00, 0x02, 0xee, 0x75,
+  0x8e, 0xb0, 0x0b, 0xf3, 0x00, 0x05, 0xf5, 0x1f, 0xb0, 0x00, 0x00, 0xf9, 0x4f, 0xfe, 0xee, 0xee,
+  0xfa, 0x3f, 0x92, 0x22, 0x22, 0x21, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x20,
+  0x02, 0xdf, 0x96, 0x7b, 0xf4, 0x00, 0x19, 0xdf, 0xea, 0x40, 0x00, 0x18, 0xde, 0x70, 0x00, 0xaf,
+  0x95, 0x20, 0x01, 0xfb, 0x00, 0x00, 0x02, 0xf9, 0x00, 0x00, 0xbf, 0xff, 0xff, 0x80, 0x15, 0xfb,
+  0x44, 0x20, 0x02, 0xfa, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x02, 0xfa,
+  0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x02, 0xfa,
+  0x00, 0x00, 0x00, 0x5c, 0xef, 0xff, 0xfe, 0x07, 0xf9, 0x45, 0xcf, 0xc6, 0x0d, 0xc0, 0x00, 0x1f,
+  0x90, 0x0e, 0xb0, 0x00, 0x0f, 0x90, 0x08, 0xf6, 0x11, 0x9f, 0x40, 0x00, 0xcf, 0xff, 0xd5, 0x00,
+  0x07, 0xf4, 0x32, 0x10, 0x00, 0x04, 0xef, 0xff, 0xfe, 0x90, 0x0a, 0xc4, 0x44, 0x6b, 0xf7, 0x6f,
+  0x20, 0x00, 0x01, 0xfa, 0x7f, 0x30, 0x00, 0x04, 0xf6, 0x1e, 0xe7, 0x55, 0x8e, 0xb0, 0x02, 0x9d,
+  0xfe, 0xc6, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x8f, 0x40, 0x00,
+  0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x8f, 0x47, 0xdf, 0xd5, 0x00, 0x8f, 0xdc, 0x77, 0xdf,
+  0x40, 0x8f, 0x90, 0x00, 0x3f, 0xb0, 0x8f, 0x40, 0x00, 0x0e, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0,
+  0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x8f,
+  0x40, 0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x6e, 0x70, 0x9f, 0xb0, 0x16, 0x20, 0x00,
+  0x00, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f,
+  0x70, 0x5f, 0x70, 0x5f, 0x70, 0x00, 0x6e, 0x70, 0x00, 0x9f, 0xb0, 0x00, 0x16, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70,
+  0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00,
+  0x6f, 0x60, 0x25, 0xcf, 0x30, 0x7f, 0xd6, 0x00, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00,
+  0x00, 0x00, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00, 0x00, 0x00, 0x7f, 0x50, 0x00, 0x8f,
+  0x60, 0x7f, 0x50, 0x07, 0xf7, 0x00, 0x7f, 0x50, 0x7f, 0x80, 0x00, 0x7f, 0x56, 0xf9, 0x00, 0x00,
+  0x7f, 0xff, 0xd0, 0x00, 0x00, 0x7f, 0x78, 0xf8, 0x00, 0x00, 0x7f, 0x50, 0xaf, 0x50, 0x00, 0x7f,
+  0x50, 0x1c, 0xe3, 0x00, 0x7f, 0x50, 0x02, 0xed, 0x10, 0x7f, 0x50, 0x00, 0x4e, 0xb0, 0x5f, 0x70,
+  0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70,
+  0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x5f, 0x70, 0x8e, 0x19, 0xee, 0x80, 0x3b, 0xed,
+  0x80, 0x00, 0x8f, 0xd8, 0x48, 0xf8, 0xe7, 0x49, 0xf9, 0x00, 0x8f, 0x60, 0x00, 0xcf, 0x70, 0x00,
+  0xcf, 0x00, 0x8f, 0x40, 0x00, 0x9f, 0x40, 0x00, 0x9f, 0x20, 0x8f, 0x40, 0x00, 0x9f, 0x30, 0x00,
+  0x9f, 0x30, 0x8f, 0x40, 0x00, 0x9f, 0x30, 0x00, 0x9f, 0x30, 0x8f, 0x40, 0x00, 0x9f, 0x30, 0x00,
+  0x9f, 0x30, 0x8f, 0x40, 0x00, 0x9f, 0x30, 0x00, 0x9f, 0x30, 0x8f, 0x40, 0x00, 0x9f, 0x30, 0x00,
+  0x9f, 0x30, 0x8f, 0x40, 0x00, 0x9f, 0x30, 0x00, 0x9f, 0x30, 0x8e, 0x17, 0xdf, 0xd5, 0x00, 0x8f,
+  0xda, 0x45, 0xcf, 0x40, 0x8f, 0x70, 0x00, 0x2f, 0xb0, 0x8f, 0x40, 0x00, 0x0e, 0xd0, 0x8f, 0x40,
+  0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00,
+  0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x8f, 0x40, 0x00, 0x0d, 0xd0, 0x00, 0x29, 0xdf, 0xea,
+  0x20, 0x00, 0x02, 0xef, 0x96, 0x8e, 0xe3, 0x00, 0x0b, 0xf4, 0x00, 0x03, 0xfc, 0x00, 0x1f, 0xc0,
+  0x00, 0x00, 0xaf, 0x30, 0x4f, 0x90, 0x00, 0x00, 0x8f, 0x50, 0x4f, 0x90, 0x00, 0x00, 0x8f, 0x50,
+  0x1f, 0xc0, 0x00, 0x00, 0xaf, 0x30, 0x0b, 0xf4, 0x00, 0x03, 0xfc, 0x00, 0x02, 0xef, 0x86, 0x8e,
+  0xe3, 0x00, 0x00, 0x29, 0xdf, 0xea, 0x20, 0x00, 0x8e, 0x17, 0xdf, 0xd7, 0x00, 0x8f, 0xc9, 0x45,
+  0xbf, 0x70, 0x8f, 0x70, 0x00, 0x0d, 0xe1, 0x8f, 0x40, 0x00, 0x09, 0xf4, 0x8f, 0x40, 0x00, 0x07,
+  0xf5, 0x8f, 0x40, 0x00, 0x08, 0xf5, 0x8f, 0x40, 0x00, 0x0a, 0xf3, 0x8f, 0x50, 0x00, 0x3f, 0xd0,
+  0x8f, 0xe8, 0x68, 0xef, 0x40, 0x8f, 0x5a, 0xee, 0xb3, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x8f,
+  0x40, 0x00, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xee, 0xb3, 0xda, 0x03, 0xef,
+  0x96, 0x8d, 0xfa, 0x0b, 0xf4, 0x00, 0x04, 0xfa, 0x1f, 0xc0, 0x00, 0x02, 0xfa, 0x4f, 0x90, 0x00,
+  0x02, 0xfa, 0x4f, 0x90, 0x00, 0x02, 0xfa, 0x2f, 0xb0, 0x00, 0x02, 0xfa, 0x0d, 0xf2, 0x00, 0x07,
+  0xfa, 0x06, 0xfe, 0x87, 0xbc, 0xfa, 0x00, 0x6d, 0xfd, 0x72, 0xfa, 0x00, 0x00, 0x00, 0x02, 0xfa,
+  0x00, 0x00, 0x00, 0x02, 0xfa, 0x00, 0x00, 0x00, 0x02, 0xfa, 0x8e, 0x07, 0xdf, 0x70, 0x8f, 0x9f,
+  0xcb, 0x40, 0x8f, 0xd2, 0x00, 0x00, 0x8f, 0x50, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x8f, 0x40,
+  0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x8f, 0x40, 0x00, 0x00, 0x8f, 0x40,
+  0x00, 0x00, 0x01, 0x8d, 0xfd, 0x81, 0x0a, 0xf8, 0x57, 0xc6, 0x1f, 0xa0, 0x00, 0x00, 0x0e, 0xe3,
+  0x00, 0x00, 0x05, 0xef, 0xd8, 0x20, 0x00, 0x16, 0xbf, 0xf4, 0x00, 0x00, 0x03, 0xfb, 0x01, 0x00,
+  0x00, 0xeb, 0x2f, 0x95, 0x5a, 0xf4, 0x06, 0xce, 0xeb, 0x40, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xac,
+  0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xb0, 0x24, 0xfd, 0x44, 0x30, 0x00, 0xec,
+  0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xec,
+  0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xbf, 0x88, 0x80, 0x00, 0x3c, 0xec, 0x60, 0xcf, 0x00,
+  0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00,
+  0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xbf, 0x00, 0x00, 0x2f,
+  0xa0, 0x9f, 0x30, 0x00, 0x5f, 0xa0, 0x3f, 0xd5, 0x48, 0xdf, 0xa0, 0x04, 0xcf, 0xd8, 0x1d, 0xa0,
+  0x9f, 0x30, 0x00, 0x00, 0xdd, 0x00, 0x3f, 0xa0, 0x00, 0x05, 0xf6, 0x00, 0x0c, 0xf1, 0x00, 0x0b,
+  0xe1, 0x00, 0x06, 0xf7, 0x00, 0x2f, 0x90, 0x00, 0x00, 0xed, 0x00, 0x8f, 0x30, 0x00, 0x00, 0x8f,
+  0x40, 0xec, 0x00, 0x00, 0x00, 0x2f, 0xa5, 0xf5, 0x00, 0x00, 0x00, 0x0b, 0xeb, 0xe0, 0x00, 0x00,
+  0x00, 0x05, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x20, 0x00, 0x00, 0xbe, 0x20, 0x00, 0x3f,
+  0x90, 0x00, 0x0a, 0xf1, 0x6f, 0x70, 0x00, 0x8f, 0xe0, 0x00, 0x1f, 0xa0, 0x1f, 0xb0, 0x00, 0xdb,
+  0xf4, 0x00, 0x5f, 0x50, 0x0b, 0xf1, 0x03, 0xf4, 0xd9, 0x00, 0xaf, 0x10, 0x06, 0xf5, 0x08, 0xd0,
+  0x9e, 0x00, 0xeb, 0x00, 0x01, 0xfa, 0x0d, 0x80, 0x4f, 0x44, 0xf6, 0x00, 0x00, 0xbe, 0x3f, 0x30,
+  0x0d, 0x98, 0xf1, 0x00, 0x00, 0x6f, 0xad, 0x00, 0x09, 0xdc, 0xb0, 0x00, 0x00, 0x1f, 0xf8, 0x00,
+  0x04, 0xff, 0x60, 0x00, 0x00, 0x0b, 0xf3, 0x00, 0x00, 0xdf, 0x10, 0x00, 0x4f, 0xb0, 0x00, 0x08,
+  0xf4, 0x08, 0xf7, 0x00, 0x4f, 0x90, 0x00, 0xce, 0x21, 0xdc, 0x00, 0x00, 0x2f, 0xb9, 0xf3, 0x00,
+  0x00, 0x07, 0xff, 0x70, 0x00, 0x00, 0x09, 0xff, 0xb0, 0x00, 0x00, 0x4f, 0x98, 0xf6, 0x00, 0x01,
+  0xed, 0x10, 0xde, 0x20, 0x0a, 0xf3, 0x00, 0x3f, 0xb0, 0x6f, 0x70, 0x00, 0x08, 0xf7, 0xaf, 0x40,
+  0x00, 0x00, 0xdd, 0x00, 0x3f, 0xb0, 0x00, 0x05, 0xf6, 0x00, 0x0b, 0xf3, 0x00, 0x0c, 0xe1, 0x00,
+  0x04, 0xf9, 0x00, 0x3f, 0x80, 0x00, 0x00, 0xcf, 0x10, 0xaf, 0x10, 0x00, 0x00, 0x5f, 0x81, 0xf9,
+  0x00, 0x00, 0x00, 0x0d, 0xe8, 0xf2, 0x00, 0x00, 0x00, 0x07, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x01,
+  0xef, 0x40, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf6, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x60, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff,
+  0x80, 0x05, 0x55, 0x55, 0xdf, 0x30, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00,
+  0x00, 0x01, 0xdd, 0x10, 0x00, 0x00, 0x0a, 0xf3, 0x00, 0x00, 0x00, 0x6f, 0x70, 0x00, 0x00, 0x03,
+  0xfa, 0x00, 0x00, 0x00, 0x1d, 0xf6, 0x55, 0x55, 0x20, 0x4f, 0xff, 0xff, 0xff, 0x50, 0x00, 0x4c,
+  0xe2, 0x03, 0xf9, 0x30, 0x09, 0xe0, 0x00, 0x0a, 0xd0, 0x00, 0x09, 0xe0, 0x00, 0x07, 0xf2, 0x00,
+  0x04, 0xf4, 0x00, 0x03, 0xf4, 0x00, 0x08, 0xe1, 0x00, 0x8f, 0x50, 0x00, 0x19, 0xe1, 0x00, 0x03,
+  0xf4, 0x00, 0x04, 0xf3, 0x00, 0x07, 0xf1, 0x00, 0x0a, 0xe0, 0x00, 0x0a, 0xe0, 0x00, 0x06, 0xf6,
+  0x00, 0x00, 0x8f, 0xf1, 0x00, 0x00, 0x20, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba,
+  0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x2e, 0xc4, 0x00, 0x03, 0x9f, 0x30, 0x00,
+  0x0e, 0x80, 0x00, 0x0d, 0xa0, 0x00, 0x0f, 0x90, 0x00, 0x2f, 0x60, 0x00, 0x4f, 0x40, 0x00, 0x4f,
+  0x30, 0x00, 0x1e, 0x80, 0x00, 0x05, 0xf8, 0x00, 0x1e, 0x91, 0x00, 0x4f, 0x30, 0x00, 0x3f, 0x40,
+  0x00, 0x1f, 0x70, 0x00, 0x0e, 0xa0, 0x00, 0x0e, 0xa0, 0x00, 0x6f, 0x60, 0x1f, 0xf8, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x11, 0x00, 0x01, 0xa4, 0x1b, 0xff, 0xb6, 0x38, 0xf3, 0x8f, 0x76, 0xbf, 0xff,
+  0x90, 0xa8, 0x00, 0x01, 0x42, 0x00, 0x01, 0x9d, 0xd8, 0x10, 0x0b, 0xc4, 0x4d, 0xa0, 0x3f, 0x20,
+  0x03, 0xf1, 0x3f, 0x10, 0x02, 0xf2, 0x0d, 0xa1, 0x1b, 0xc0, 0x03, 0xcf, 0xfb, 0x20, 0x00, 0x01,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xc2, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x9e,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x49, 0xf3, 0x00, 0x00, 0x00, 0x01, 0xed, 0x04, 0xfa, 0x00,
+  0x00, 0x00, 0x06, 0xf7, 0x00, 0xdf, 0x10, 0x00, 0x00, 0x0d, 0xf2, 0x00, 0x7f, 0x70, 0x00, 0x00,
+  0x4f, 0xa0, 0x00, 0x1f, 0xd0, 0x00, 0x00, 0xaf, 0x61, 0x11, 0x1b, 0xf4, 0x00, 0x01, 0xff, 0xff,
+  0xff, 0xff, 0xfa, 0x00, 0x07, 0xf9, 0x44, 0x44, 0x44, 0xdf, 0x20, 0x0d, 0xf2, 0x00, 0x00, 0x00,
+  0x7f, 0x80, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x1f, 0xd0, 0xbf, 0x40, 0x00, 0x00, 0x00, 0x09, 0xf5,
+  0x00, 0x00, 0x01, 0x78, 0x30, 0x00, 0x00, 0x1b, 0xf6, 0x00, 0x00, 0x01, 0xbd, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xf8, 0x4f, 0xd8, 0x88, 0x88, 0x85, 0x4f, 0xa0,
+  0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xb2, 0x22,
+  0x22, 0x10, 0x4f, 0xff, 0xff, 0xff, 0x40, 0x4f, 0xc5, 0x55, 0x55, 0x10, 0x4f, 0xa0, 0x00, 0x00,
+  0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00, 0x4f, 0xa0, 0x00, 0x00, 0x00,
+  0x4f, 0xd8, 0x88, 0x88, 0x84, 0x4f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x27, 0x71, 0x02, 0xde, 0x40,
+  0x2d, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e,
+  0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1,
+  0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00, 0x0e, 0xf1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xed, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2e, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x39, 0xde, 0xed, 0x92, 0x00, 0x00, 0x00, 0x08, 0xff, 0xda, 0xad, 0xff, 0x80, 0x00,
+  0x00, 0x8f, 0xc3, 0x00, 0x00, 0x3d, 0xf8, 0x00, 0x03, 0xfd, 0x10, 0x00, 0x00, 0x01, 0xef, 0x30,
+  0x0a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90, 0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0,
+  0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0,
+  0x0e, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xd0, 0x0a, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x90,
+  0x04, 0xfd, 0x10, 0x00, 0x00, 0x01, 0xdf, 0x30, 0x00, 0x9f, 0xc3, 0x00, 0x00, 0x3d, 0xf8, 0x00,
+  0x00, 0x09, 0xff, 0xca, 0xac, 0xff, 0x80, 0x00, 0x00, 0x00, 0x39, 0xde, 0xed, 0x93, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x0b, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x80, 0x00, 0x00,
+  0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef,
+  0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f,
+  0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00,
+  0x00, 0x00, 0xef, 0x00, 0x6f, 0x80, 0x00, 0x00, 0x00, 0xef, 0x00, 0x4f, 0xb0, 0x00, 0x00, 0x01,
+  0xfe, 0x00, 0x1f, 0xe2, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x08, 0xfc, 0x20, 0x00, 0x6e, 0xf3, 0x00,
+  0x00, 0xaf, 0xfc, 0xad, 0xff, 0x50, 0x00, 0x00, 0x05, 0xbe, 0xfd, 0x92, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x70, 0x00, 0x00, 0x00, 0xcf,
+  0x30, 0x1e, 0xe2, 0x00, 0x00, 0x07, 0xf9, 0x00, 0x06, 0xfa, 0x00, 0x00, 0x2e, 0xe1, 0x00, 0x00,
+  0xbf, 0x40, 0x00, 0xaf, 0x50, 0x00, 0x00, 0x2f, 0xd0, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x08, 0xf8,
+  0x0d, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xde, 0x8f, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfa,
+  0x00, 0x00, 0x00, 0x1e, 0xb0, 0x00, 0x00, 0x00, 0x79, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4a, 0xef, 0xc4, 0x00, 0x05, 0xfc, 0x77, 0xcf, 0x40, 0x01, 0x30, 0x00, 0x1f, 0xb0, 0x00,
+  0x00, 0x00, 0x0d, 0xd0, 0x00, 0x17, 0xbd, 0xef, 0xe0, 0x04, 0xed, 0x74, 0x2d, 0xe0, 0x0e, 0xd1,
+  0x00, 0x0d, 0xe0, 0x0f, 0xa0, 0x00, 0x1e, 0xe0, 0x0c, 0xe4, 0x15, 0xde, 0xe0, 0x02, 0xbe, 0xeb,
+  0x37, 0xe0, 0x00, 0x00, 0x03, 0xed, 0x10, 0x00, 0x00, 0x0c, 0xd2, 0x00, 0x00, 0x00, 0x4a, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xdf, 0xd8, 0x00, 0x02, 0xee, 0x75, 0x8e, 0xb0,
+  0x0b, 0xf3, 0x00, 0x05, 0xf5, 0x1f, 0xb0, 0x00, 0x00, 0xf9, 0x4f, 0xfe, 0xee, 0xee, 0xfa, 0x3f,
+  0x92, 0x22, 0x22, 0x21, 0x1f, 0xb0, 0x00, 0x00, 0x00, 0x0a, 0xf4, 0x00, 0x00, 0x20, 0x02, 0xdf,
+  0x96, 0x7b, 0xf4, 0x00, 0x19, 0xdf, 0xea, 0x40, 0x02, 0xed, 0x20, 0x0b, 0xe2, 0x00, 0x39, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00,
+  0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f, 0x70, 0x00, 0x5f,
+  0x70, 0x00, 0x00, 0x00, 0x02, 0xed, 0x20, 0x00, 0x00, 0x00, 0x0b, 0xe2, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xdf, 0xea, 0x20, 0x00,
+  0x02, 0xef, 0x96, 0x8e, 0xe3, 0x00, 0x0b, 0xf4, 0x00, 0x03, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0x00,
+  0xaf, 0x30, 0x4f, 0x90, 0x00, 0x00, 0x8f, 0x50, 0x4f, 0x90, 0x00, 0x00, 0x8f, 0x50, 0x1f, 0xc0,
+  0x00, 0x00, 0xaf, 0x30, 0x0b, 0xf4, 0x00, 0x03, 0xfc, 0x00, 0x02, 0xef, 0x86, 0x8e, 0xe3, 0x00,
+  0x00, 0x29, 0xdf, 0xea, 0x20, 0x00, 0x00, 0x00, 0x3e, 0xd1, 0x00, 0x00, 0x00, 0xcd, 0x10, 0x00,
+  0x00, 0x04, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xcf,
+  0x00, 0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xcf, 0x00,
+  0x00, 0x2f, 0xa0, 0xcf, 0x00, 0x00, 0x2f, 0xa0, 0xbf, 0x00, 0x00, 0x2f, 0xa0, 0x9f, 0x30, 0x00,
+  0x5f, 0xa0, 0x3f, 0xd5, 0x48, 0xdf, 0xa0, 0x04, 0xcf, 0xd8, 0x1d, 0xa0, 0x00, 0x00, 0x05, 0xfb,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x58, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0x40, 0x00, 0x00, 0xdd, 0x00, 0x3f, 0xb0, 0x00, 0x05, 0xf6, 0x00,
+  0x0b, 0xf3, 0x00, 0x0c, 0xe1, 0x00, 0x04, 0xf9, 0x00, 0x3f, 0x80, 0x00, 0x00, 0xcf, 0x10, 0xaf,
+  0x10, 0x00, 0x00, 0x5f, 0x81, 0xf9, 0x00, 0x00, 0x00, 0x0d, 0xe8, 0xf2, 0x00, 0x00, 0x00, 0x07,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x01, 0xef, 0x40, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x2c, 0xb2, 0x6e, 0x70, 0x00, 0x01, 0xaf, 0xe5, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x18, 0xdf, 0xeb, 0x40, 0x01, 0xdf, 0xc9, 0xae, 0xf5, 0x08, 0xf7, 0x00, 0x01, 0x71,
+  0x0b, 0xf1, 0x00, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00, 0x00, 0x05, 0xff, 0x82, 0x00, 0x00, 0x00,
+  0x6e, 0xff, 0xc6, 0x00, 0x00, 0x01, 0x6b, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x1b, 0xfa, 0x00, 0x00,
+  0x00, 0x01, 0xfd, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x1c, 0x60, 0x00, 0x09, 0xf7, 0x2d, 0xfd, 0xa9,
+  0xdf, 0xc1, 0x01, 0x7c, 0xef, 0xc7, 0x00, 0x02, 0xe8, 0x05, 0xe3, 0x00, 0x4f, 0xbf, 0x50, 0x00,
+  0x05, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8d, 0xfd, 0x81, 0x0a, 0xf8, 0x57, 0xc5, 0x1f,
+  0xa0, 0x00, 0x00, 0x0e, 0xe3, 0x00, 0x00, 0x05, 0xef, 0xd8, 0x20, 0x00, 0x16, 0xbf, 0xf4, 0x00,
+  0x00, 0x03, 0xfb, 0x01, 0x00, 0x00, 0xeb, 0x2f, 0x95, 0x5a, 0xf4, 0x06, 0xce, 0xeb, 0x40, 0x00,
+  0x04, 0xe9, 0x19, 0xe4, 0x00, 0x00, 0x00, 0x2d, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x06, 0x88, 0x88, 0x88, 0x8f, 0xf6, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xa0, 0x00, 0x00, 0x00, 0x04, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x1e, 0xf3, 0x00, 0x00,
+  0x00, 0x00, 0xbf, 0x70, 0x00, 0x00, 0x00, 0x07, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe2, 0x00,
+  0x00, 0x00, 0x01, 0xdf, 0x50, 0x00, 0x00, 0x00, 0x09, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xc0,
+  0x00, 0x00, 0x00, 0x02, 0xee, 0x20, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0x88, 0x88, 0x88, 0x85, 0x2f,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0x00, 0xbb, 0x12, 0xd7, 0x00, 0x00, 0x1c, 0xce, 0x90, 0x00, 0x00,
+  0x02, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x05, 0x55,
+  0x55, 0xdf, 0x30, 0x00, 0x00, 0x06, 0xf7, 0x00, 0x00, 0x00, 0x3f, 0xb0, 0x00, 0x00, 0x01, 0xdd,
+  0x10, 0x00, 0x00, 0x0a, 0xf3, 0x00, 0x00, 0x00, 0x6f, 0x70, 0x00, 0x00, 0x03, 0xfa, 0x00, 0x00,
+  0x00, 0x1d, 0xf6, 0x55, 0x55, 0x20, 0x4f, 0xff, 0xff, 0xff, 0x50,
+};
+} // namespace lato20_data
+
+inline constexpr Font lato20{24,
+  20,
+  lato20_data::glyphs,
+  sizeof(lato20_data::glyphs) / sizeof(Font::Glyph),
+  lato20_data::atlas};
+} // namespace fonts
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// FNV-1a hash of packed frame bytes (must match tools/encodeFrame.js)
+struct FrameHash {
+  static constexpr uint32_t offsetBasis = 2166136261u;
+  static constexpr uint32_t prime = 16777619u;
+
+  uint32_t value{offsetBasis};
+
+  void update(const uint8_t* data, std::size_t size) {
+    uint32_t hash = value;
+    for (std::size_t i = 0; i < size; i++) {
+      hash = (hash ^ data[i]) * prime;
+    }
+    value = hash;
+  }
+};
@@ -0,0 +1,55 @@
+#include "frame_store.hpp"
+
+#include "exception.hpp"
+#include "simple_logger.hpp"
+
+const char* TAG_FRAME_STORE = "frameStore";
+
+constexpr esp_partition_subtype_t frameStoreSubtype = static_cast<esp_partition_subtype_t>(0x40);
+constexpr uint32_t flashSectorSize = 0x1000;
+
+FrameStore::FrameStore() :
+  _partition{esp_partition_find_first(ESP_PARTITION_TYPE_DATA, frameStoreSubtype, "frame")} {
+  if (_partition == nullptr) throw Exception("Frame partition not found");
+
+  Exception::check(esp_partition_read(_partition, 0, &_metadata, sizeof(_metadata)));
+  if (_metadata.magic != metadataMagic) _metadata = {};
+}
+
+bool FrameStore::hasFrame() const {
+  return _metadata.magic == metadataMagic;
+}
+
+uint32_t FrameStore::hash() const {
+  return _metadata.hash;
+}
+
+bool FrameStore::matches(uint32_t hash, uint16_t width, uint16_t height) const {
+  return hasFrame() && _metadata.hash == hash && _metadata.width == width && _metadata.height == height;
+}
+
+void FrameStore::beginWrite(uint32_t frameSize) {
+  if (pixelsOffset + frameSize > _partition->size) throw Exception("Frame doesn't fit into frame partition");
+
+  logI(TAG_FRAME_STORE, "erasing stored frame");
+
+  _metadata = {};
+  const uint32_t eraseSize = (pixelsOffset + frameSize + flashSectorSize - 1) / flashSectorSize * flashSectorSize;
+  Exception::check(esp_partition_erase_range(_partition, 0, eraseSize));
+}
+
+void FrameStore::write(uint32_t offset, const uint8_t* data, uint32_t size) {
+  Exception::check(esp_partition_write(_partition, pixelsOffset + offset, data, size));
+}
+
+void FrameStore::commit(uint32_t hash, uint16_t width, uint16_t height) {
+  Metadata metadata{metadataMagic, hash, width, height};
+  Exception::check(esp_partition_write(_partition, 0, &metadata, sizeof(metadata)));
+  _metadata = metadata;
+
+  logI(TAG_FRAME_STORE, "stored frame %08x", hash);
+}
+
+void FrameStore::read(uint32_t offset, uint8_t* data, uint32_t size) const {
+  Exception::check(esp_partition_read(_partition, pixelsOffset + offset, data, size));
+}
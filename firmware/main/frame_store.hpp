@@ -0,0 +1,37 @@
+#pragma once
+
+#include "esp_partition.h"
+
+#include <cstdint>
+
+// Base frame for XOR delta frames, stored unpacked (4bpp) in "frame" data partition.
+// Metadata sector is written last, so interrupted write leaves no valid frame.
+struct FrameStore {
+  struct Metadata {
+    uint32_t magic;
+    uint32_t hash;
+    uint16_t width;
+    uint16_t height;
+  };
+
+private:
+  static constexpr uint32_t metadataMagic = 0x45465342; // "BSFE"
+  static constexpr uint32_t pixelsOffset = 0x1000; // metadata occupies the first sector
+
+  const esp_partition_t* _partition{};
+  Metadata _metadata{};
+
+public:
+  FrameStore();
+
+  bool hasFrame() const;
+  uint32_t hash() const;
+  bool matches(uint32_t hash, uint16_t width, uint16_t height) const;
+
+  // erases stored frame, followed by write() of all pixels and commit()
+  void beginWrite(uint32_t frameSize);
+  void write(uint32_t offset, const uint8_t* data, uint32_t size);
+  void commit(uint32_t hash, uint16_t width, uint16_t height);
+
+  void read(uint32_t offset, uint8_t* data, uint32_t size) const;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+// Writes Adam7 interlaced PNG pixels to display memory band by band.
+//
+// pngle draws every pass pixel as a block (w x h) covering pixels of following passes, so one pass row is a band of
+// h display rows. Passes 1, 3, 5 and 7 cover the whole band width. Passes 2, 4 and 6 start at x > 0 and cover only
+// some columns, the rest of the band keeps what earlier passes drew. Since earlier blocks are at least as tall as the
+// band, the band is vertically uniform and its first row loaded back from display memory is enough to merge with.
+struct InterlacedBandWriter {
+  // fills first row of the band (packed 4bpp) with current display memory content at row y
+  using LoadCallback = std::function<void(uint16_t y, uint8_t* row)>;
+  using WriteCallback = std::function<void(uint16_t y, uint16_t height, const uint8_t* band)>;
+
+private:
+  uint8_t* _buffer;
+  std::size_t _bufferSize;
+  LoadCallback _onLoad;
+  WriteCallback _onWrite;
+
+  uint32_t _width{};
+  uint32_t _rowSize{};
+  bool _hasBand{};
+  bool _isLoaded{};
+  uint32_t _bandY{};
+  uint32_t _bandHeight{};
+  uint32_t _lastX{};
+  uint32_t _drawnEnd{};
+  uint32_t _writtenBands{};
+
+public:
+  InterlacedBandWriter(uint8_t* buffer, std::size_t bufferSize, LoadCallback onLoad, WriteCallback onWrite) :
+    _buffer{buffer},
+    _bufferSize{bufferSize},
+    _onLoad{std::move(onLoad)},
+    _onWrite{std::move(onWrite)} {
+  }
+
+  void begin(uint32_t width) {
+    _width = width;
+    _rowSize = (width + 1) / 2;
+    _hasBand = false;
+    _writtenBands = 0;
+  }
+
+  // level: 0..15 gray
+  void draw(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t level) {
+    const bool isNewBand = !_hasBand || y != _bandY || x <= _lastX;
+    if (isNewBand) {
+      flush();
+      beginBand(x, y, h);
+    }
+    _lastX = x;
+    _drawnEnd = x + w;
+
+    for (uint32_t i = x; i < x + w; i++) {
+      uint8_t& byte = _buffer[i / 2];
+      byte = (i % 2) == 0 ? (byte & 0x0f) | (level << 4) : (byte & 0xf0) | level;
+    }
+  }
+
+  // writes pending band, called on the end of the image (or when it won't be finished)
+  void flush() {
+    if (!_hasBand) return;
+    _hasBand = false;
+    if (!_isLoaded && _drawnEnd < _width) loadRest();
+
+    for (uint32_t row = 1; row < _bandHeight; row++) std::memcpy(_buffer + row * _rowSize, _buffer, _rowSize);
+    _onWrite(_bandY, _bandHeight, _buffer);
+    _writtenBands++;
+  }
+
+  uint32_t writtenBands() const {
+    return _writtenBands;
+  }
+
+private:
+  void beginBand(uint32_t x, uint32_t y, uint32_t h) {
+    _hasBand = true;
+    _bandY = y;
+    _bandHeight = std::min<uint32_t>(h, _bufferSize / _rowSize);
+
+    // band of full width pass is overwritten as whole
+    _isLoaded = x != 0;
+    if (_isLoaded) _onLoad(y, _buffer);
+  }
+
+  // band of full width pass flushed in the middle of its row (preview of unfinished image) keeps the rest of the row
+  void loadRest() {
+    const std::vector<uint8_t> drawn(_buffer, _buffer + (_drawnEnd + 1) / 2);
+    _onLoad(_bandY, _buffer);
+    std::copy_n(drawn.begin(), _drawnEnd / 2, _buffer);
+    if (_drawnEnd % 2 != 0) _buffer[_drawnEnd / 2] = (drawn.back() & 0xf0) | (_buffer[_drawnEnd / 2] & 0x0f);
+  }
+};
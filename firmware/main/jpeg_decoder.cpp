@@ -0,0 +1,106 @@
+#include "jpeg_decoder.hpp"
+
+#include "esp32/rom/tjpgd.h"
+
+#include <algorithm>
+
+// C callbacks of ROM TJpgDec, decoder instance is its device pointer
+struct JpegDecoderRom {
+  static UINT input(JDEC* jd, BYTE* buffer, UINT size) {
+    return static_cast<JpegDecoder*>(jd->device)->_read(buffer, size);
+  }
+
+  static UINT output(JDEC* jd, void* bitmap, JRECT* rect) {
+    return static_cast<JpegDecoder*>(jd->device)->writeBlock(
+      static_cast<const uint8_t*>(bitmap), rect->left, rect->top, rect->right, rect->bottom);
+  }
+
+  static const char* errorText(JRESULT result) {
+    switch (result) {
+      case JDR_INTR:
+        return "Interrupted";
+      case JDR_INP:
+        return "Input stream ended";
+      case JDR_MEM1:
+        return "Insufficient workspace";
+      case JDR_MEM2:
+        return "Insufficient input buffer";
+      case JDR_PAR:
+        return "Invalid parameter";
+      case JDR_FMT1:
+        return "Data format error";
+      case JDR_FMT2:
+        return "Right format but not supported";
+      case JDR_FMT3:
+        return "Not supported JPEG standard (baseline YCbCr only)";
+      default:
+        return "Unknown error";
+    }
+  }
+};
+
+bool JpegDecoder::isJpeg(const uint8_t* data, std::size_t size) {
+  // SOI marker followed by another marker
+  return size >= 3 && data[0] == 0xff && data[1] == 0xd8 && data[2] == 0xff;
+}
+
+bool JpegDecoder::decode(ReadCallback read, BeginCallback onBegin, RowCallback onRow) {
+  _read = std::move(read);
+  _onBegin = std::move(onBegin);
+  _onRow = std::move(onRow);
+  _error = "No error";
+  _workspace.resize(workspaceSize);
+
+  JDEC jd{};
+  JRESULT result = jd_prepare(&jd, JpegDecoderRom::input, _workspace.data(), _workspace.size(), this);
+  if (result == JDR_OK) {
+    _width = jd.width;
+    _height = jd.height;
+    if (!_onBegin(_width, _height)) {
+      release();
+      _error = "Rejected";
+      return false;
+    }
+
+    const uint32_t mcuHeight = jd.msy * 8;
+    _band.resize(_width * mcuHeight);
+    result = jd_decomp(&jd, JpegDecoderRom::output, 0);
+  }
+
+  release();
+  if (result != JDR_OK) {
+    _error = JpegDecoderRom::errorText(result);
+    return false;
+  }
+  return true;
+}
+
+const char* JpegDecoder::error() const {
+  return _error;
+}
+
+bool JpegDecoder::writeBlock(const uint8_t* rgb, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom) {
+  // NOTE blocks are clipped to the image by TJpgDec, so the last block of MCU row ends at the right image edge
+  const uint32_t blockWidth = right - left + 1;
+  const uint32_t rowsPerBand = _band.size() / _width;
+  for (uint32_t y = top; y <= bottom; y++) {
+    uint8_t* gray = _band.data() + (y % rowsPerBand) * _width + left;
+    for (uint32_t x = 0; x < blockWidth; x++, rgb += 3) {
+      // ITU-R BT.601 luma, photos don't have to be converted to gray by the publisher
+      gray[x] = (rgb[0] * 77 + rgb[1] * 150 + rgb[2] * 29) >> 8;
+    }
+  }
+
+  if (right + 1 == _width) {
+    for (uint32_t y = top; y <= bottom; y++) _onRow(y, _band.data() + (y % rowsPerBand) * _width);
+  }
+  return true;
+}
+
+void JpegDecoder::release() {
+  _read = nullptr;
+  _onBegin = nullptr;
+  _onRow = nullptr;
+  _workspace = {};
+  _band = {};
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Baseline JPEG decoder on top of TJpgDec in the ESP32 mask ROM.
+//
+// TJpgDec pulls its input and outputs MCU blocks (8x8 to 16x16 pixels) left to right. Blocks are collected in a band
+// of one MCU row and handed over as 8 bit gray rows in raster order, so the rows can go through the same dithering
+// and strip packing as non-interlaced PNG rows. ROM version (R0.01) decodes YCbCr JPEG only, single component
+// (grayscale) JPEG is rejected as unsupported format.
+class JpegDecoder {
+public:
+  // fills buffer (or skips input when buffer is nullptr) and returns the number of bytes, 0 at the end of input
+  using ReadCallback = std::function<std::size_t(uint8_t* buffer, std::size_t size)>;
+  // return false to stop decoding
+  using BeginCallback = std::function<bool(uint32_t width, uint32_t height)>;
+  using RowCallback = std::function<void(uint32_t y, const uint8_t* gray)>;
+
+private:
+  static constexpr std::size_t workspaceSize = 3100; // required by ROM TJpgDec
+
+  ReadCallback _read;
+  BeginCallback _onBegin;
+  RowCallback _onRow;
+
+  std::vector<uint8_t> _workspace{};
+  std::vector<uint8_t> _band{}; // gray pixels of one MCU row
+  uint32_t _width{};
+  uint32_t _height{};
+  const char* _error{"No error"};
+
+public:
+  static bool isJpeg(const uint8_t* data, std::size_t size);
+
+  // decodes whole image, buffers are allocated only meanwhile, returns false on error (see error())
+  bool decode(ReadCallback read, BeginCallback onBegin, RowCallback onRow);
+  const char* error() const;
+
+private:
+  bool writeBlock(const uint8_t* rgb, uint32_t left, uint32_t top, uint32_t right, uint32_t bottom);
+  void release();
+
+  friend struct JpegDecoderRom;
+};
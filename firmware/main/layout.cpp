@@ -0,0 +1,283 @@
+#include "layout.hpp"
+
+#include "font_lato20.hpp"
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+
+namespace {
+enum class Command : uint8_t { BOX = 0x01, TEXT = 0x02, ICON = 0x03, SPARKLINE = 0x04 };
+
+constexpr uint8_t noFill = 0xff;
+constexpr uint8_t maxLevel = 15;
+constexpr uint8_t maxScale = 8;
+
+// little-endian fields of the message, caller checks the size first
+struct Reader {
+  const uint8_t* it;
+  const uint8_t* end;
+
+  bool has(std::size_t size) const {
+    return static_cast<std::size_t>(end - it) >= size;
+  }
+
+  uint8_t u8() {
+    return *it++;
+  }
+
+  uint16_t u16() {
+    const uint16_t value = it[0] | (it[1] << 8);
+    it += 2;
+    return value;
+  }
+
+  int16_t i16() {
+    return static_cast<int16_t>(u16());
+  }
+};
+
+const Font* findFont(uint8_t id) {
+  return id == 0 ? &fonts::lato20 : nullptr;
+}
+
+const Sprite* findIcon(uint8_t id) {
+  static constexpr Sprite icons[] = {sprites::battery[0].view(),
+    sprites::battery[1].view(),
+    sprites::battery[2].view(),
+    sprites::battery[3].view(),
+    sprites::battery[4].view(),
+    sprites::battery[5].view(),
+    sprites::battery[6].view(),
+    sprites::battery[7].view(),
+    sprites::battery[8].view(),
+    sprites::battery[9].view(),
+    sprites::battery[10].view(),
+    sprites::wifi[0].view(),
+    sprites::wifi[1].view(),
+    sprites::wifi[2].view(),
+    sprites::wifi[3].view(),
+    sprites::wifi[4].view(),
+    sprites::stale.view(),
+    sprites::error.view()};
+  static constexpr Sprite weatherIcons[] = {
+    sprites::sun.view(), sprites::cloud.view(), sprites::rain.view(), sprites::snow.view(), sprites::storm.view()};
+  constexpr uint8_t weatherIconsStart = 32;
+
+  if (id < std::size(icons)) return &icons[id];
+  if (id >= weatherIconsStart && static_cast<std::size_t>(id - weatherIconsStart) < std::size(weatherIcons)) {
+    return &weatherIcons[id - weatherIconsStart];
+  }
+  return nullptr;
+}
+
+// strip of packed 4bpp rows at x, y on the display
+struct Strip {
+  uint8_t* pixels;
+  int32_t x;
+  int32_t y;
+  int32_t width;
+  int32_t height;
+
+  // rectangle in display coordinates, clipped to the strip
+  void fill(int32_t left, int32_t top, int32_t right, int32_t bottom, uint8_t level) const {
+    left = std::max(left, x) - x;
+    right = std::min(right, x + width) - x;
+    top = std::max(top, y) - y;
+    bottom = std::min(bottom, y + height) - y;
+    if (left >= right || top >= bottom) return;
+
+    const uint32_t rowSize = width / 2;
+    for (int32_t row = top; row < bottom; row++) {
+      uint8_t* line = pixels + row * rowSize;
+      int32_t i = left;
+      if (i % 2 != 0) {
+        line[i / 2] = (line[i / 2] & 0xf0) | level;
+        i++;
+      }
+      // NOTE pairs of pixels are whole bytes
+      const int32_t bytes = (right - i) / 2;
+      std::memset(line + i / 2, level * 0x11, bytes);
+      i += bytes * 2;
+      if (i < right) line[i / 2] = (line[i / 2] & 0x0f) | (level << 4);
+    }
+  }
+
+  void draw(const Layout::Box& box) const {
+    if (box.fill != noFill) fill(box.x, box.y, box.x + box.width, box.y + box.height, box.fill);
+    if (box.borderWidth == 0) return;
+
+    const int32_t right = box.x + box.width;
+    const int32_t bottom = box.y + box.height;
+    fill(box.x, box.y, right, box.y + box.borderWidth, box.border);
+    fill(box.x, bottom - box.borderWidth, right, bottom, box.border);
+    fill(box.x, box.y, box.x + box.borderWidth, bottom, box.border);
+    fill(right - box.borderWidth, box.y, right, bottom, box.border);
+  }
+
+  // every column is a vertical span from the line height of the previous column to its own
+  void draw(const Layout::Sparkline& line) const {
+    const int32_t bottom = line.y + line.height + line.thickness;
+    if (line.y >= y + height || bottom <= y || line.samples.empty()) return;
+
+    const int32_t count = line.samples.size();
+    const auto lineY = [&](int32_t column) {
+      // 8 bit fraction between samples
+      const int64_t position = line.width > 1 ? int64_t{column} * (count - 1) * 256 / (line.width - 1) : 0;
+      const int32_t i = std::min<int32_t>(position >> 8, count - 1);
+      const int32_t fraction = position & 0xff;
+      const int32_t next = std::min(i + 1, count - 1);
+      const int32_t value = (line.samples[i] * (256 - fraction) + line.samples[next] * fraction) >> 8;
+      return line.y + (line.height - 1) - value * (line.height - 1) / 255;
+    };
+
+    int32_t previous = lineY(0);
+    for (int32_t column = 0; column < line.width; column++) {
+      const int32_t current = lineY(column);
+      const int32_t top = std::min(previous, current);
+      const int32_t spanBottom = std::max(previous, current) + line.thickness;
+      fill(line.x + column, top, line.x + column + 1, spanBottom, line.level);
+      previous = current;
+    }
+  }
+
+  void draw(const TextOverlay& text) const {
+    blendText(std::span<const TextOverlay>{&text, 1}, pixels, x, y, width, height);
+  }
+
+  void draw(const Overlay& icon) const {
+    blendOverlays(std::span<const Overlay>{&icon, 1}, pixels, x, y, width, height);
+  }
+};
+} // namespace
+
+bool Layout::parse(const uint8_t* data, std::size_t size) {
+  _elements.clear();
+  _error = "No error";
+
+  Reader reader{data, data + size};
+  if (!reader.has(headerSize) || !isLayout(data, size)) return fail("Not a layout");
+  reader.it += magic.size();
+  if (reader.u8() != version) return fail("Unsupported layout version");
+
+  _background = reader.u8();
+  _x = reader.u16();
+  _y = reader.u16();
+  _width = reader.u16();
+  _height = reader.u16();
+  if (_background > maxLevel) return fail("Invalid background level");
+
+  while (reader.it < reader.end) {
+    const auto command = static_cast<Command>(reader.u8());
+    switch (command) {
+      case Command::BOX: {
+        if (!reader.has(11)) return fail("Truncated box");
+        const int32_t x = _x + reader.i16();
+        const int32_t y = _y + reader.i16();
+        const int32_t width = reader.u16();
+        const int32_t height = reader.u16();
+        const uint8_t fill = reader.u8();
+        const uint8_t border = reader.u8();
+        const uint8_t borderWidth = reader.u8();
+        if ((fill > maxLevel && fill != noFill) || border > maxLevel) return fail("Invalid box level");
+        if (width > _width || height > _height) return fail("Box larger than layout");
+
+        _elements.push_back(Box{x, y, width, height, fill, border, borderWidth});
+        break;
+      }
+
+      case Command::TEXT: {
+        if (!reader.has(9)) return fail("Truncated text");
+        const int32_t x = _x + reader.i16();
+        const int32_t y = _y + reader.i16();
+        const Font* font = findFont(reader.u8());
+        const uint8_t scale = reader.u8();
+        const uint8_t level = reader.u8();
+        const uint8_t align = reader.u8();
+        const uint8_t length = reader.u8();
+        if (!reader.has(length)) return fail("Truncated text");
+        if (font == nullptr) return fail("Unknown font");
+        if (scale == 0 || scale > maxScale || level > maxLevel || align > 2) return fail("Invalid text style");
+
+        const std::string_view text{reinterpret_cast<const char*>(reader.it), length};
+        reader.it += length;
+
+        auto overlay = TextOverlay::layout(*font, text, x, y, level, scale);
+        // NOTE 1 = center, 2 = right
+        overlay.translate(-overlay.width * align / 2, 0);
+        _elements.push_back(std::move(overlay));
+        break;
+      }
+
+      case Command::ICON: {
+        if (!reader.has(5)) return fail("Truncated icon");
+        const int32_t x = _x + reader.i16();
+        const int32_t y = _y + reader.i16();
+        const Sprite* icon = findIcon(reader.u8());
+        if (icon == nullptr) return fail("Unknown icon");
+        if (x < 0 || y < 0) return fail("Icon out of display");
+
+        _elements.push_back(Overlay{static_cast<uint16_t>(x), static_cast<uint16_t>(y), *icon});
+        break;
+      }
+
+      case Command::SPARKLINE: {
+        if (!reader.has(11)) return fail("Truncated sparkline");
+        const int32_t x = _x + reader.i16();
+        const int32_t y = _y + reader.i16();
+        const int32_t width = reader.u16();
+        const int32_t height = reader.u16();
+        const uint8_t level = reader.u8();
+        const uint8_t thickness = reader.u8();
+        const uint8_t count = reader.u8();
+        if (!reader.has(count)) return fail("Truncated sparkline");
+        if (level > maxLevel || thickness == 0 || height == 0) return fail("Invalid sparkline style");
+        if (width > _width || height > _height) return fail("Sparkline larger than layout");
+
+        std::vector<uint8_t> samples(reader.it, reader.it + count);
+        reader.it += count;
+        _elements.push_back(Sparkline{x, y, width, height, level, thickness, std::move(samples)});
+        break;
+      }
+
+      default:
+        return fail("Unknown layout command");
+    }
+  }
+  return true;
+}
+
+void Layout::render(uint8_t* strip, uint32_t x, uint32_t y, uint32_t width, uint32_t height) const {
+  const Strip target{strip, static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(width),
+    static_cast<int32_t>(height)};
+  std::memset(strip, _background * 0x11, width / 2 * height);
+  for (const auto& element : _elements) {
+    std::visit([&](const auto& drawable) { target.draw(drawable); }, element);
+  }
+}
+
+uint16_t Layout::x() const {
+  return _x;
+}
+
+uint16_t Layout::y() const {
+  return _y;
+}
+
+uint16_t Layout::width() const {
+  return _width;
+}
+
+uint16_t Layout::height() const {
+  return _height;
+}
+
+const char* Layout::error() const {
+  return _error;
+}
+
+bool Layout::fail(const char* error) {
+  _error = error;
+  _elements.clear();
+  return false;
+}
@@ -0,0 +1,89 @@
+// Layout: dashboard described by a few hundred bytes of drawing commands instead of pixels
+//
+// Boxes, text runs, icons and sparklines are rasterized on the device into 4bpp strips with built-in fonts and icons.
+// Encoder lives in tools/encodeLayout.js. 14 byte little-endian header is followed by commands, which are drawn in
+// order (later ones over earlier ones). Command coordinates are relative to the layout rectangle, levels are gray
+// 0 (black) .. 15 (white). Boxes and sparklines are at most as large as the layout rectangle.
+//
+//   header     "EPLY", version u8, background level u8, x u16, y u16, width u16, height u16
+//   BOX        0x01, x i16, y i16, width u16, height u16, fill level u8 (0xff = none), border level u8, border u8
+//   TEXT       0x02, x i16, y i16, font u8, scale u8, level u8, align u8, length u8, UTF-8 text of length bytes
+//              y is the top of the line, align 0 = left, 1 = center, 2 = right of x, scale 1 .. 8 enlarges glyphs
+//   ICON       0x03, x i16, y i16, icon u8
+//              0 .. 10 battery (tenths), 11 .. 15 WiFi (bars), 16 stale, 17 error (16x16),
+//              32 sun, 33 cloud, 34 rain, 35 snow, 36 storm (32x32)
+//   SPARKLINE  0x04, x i16, y i16, width u16, height u16, level u8, thickness u8, count u8, count samples u8
+//              samples are 0 (bottom) .. 255 (top), spread evenly over the width and joined by lines
+//
+// Fonts: 0 = Lato 20 px.
+
+#pragma once
+
+#include "font.hpp"
+#include "sprites.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <variant>
+#include <vector>
+
+class Layout {
+public:
+  static constexpr std::array<uint8_t, 4> magic{'E', 'P', 'L', 'Y'};
+  static constexpr uint8_t version = 1;
+  static constexpr std::size_t headerSize = 14;
+  static constexpr std::size_t maxSize = 8 * 1024;
+
+  struct Box {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    uint8_t fill;
+    uint8_t border;
+    uint8_t borderWidth;
+  };
+
+  struct Sparkline {
+    int32_t x;
+    int32_t y;
+    int32_t width;
+    int32_t height;
+    uint8_t level;
+    uint8_t thickness;
+    std::vector<uint8_t> samples;
+  };
+
+  // in display coordinates
+  using Element = std::variant<Box, TextOverlay, Overlay, Sparkline>;
+
+private:
+  uint16_t _x{};
+  uint16_t _y{};
+  uint16_t _width{};
+  uint16_t _height{};
+  uint8_t _background{};
+  std::vector<Element> _elements{};
+  const char* _error{"No error"};
+
+public:
+  static bool isLayout(const uint8_t* data, std::size_t size) {
+    return size >= magic.size() && std::memcmp(data, magic.data(), magic.size()) == 0;
+  }
+
+  // whole message, returns false on malformed layout (see error())
+  bool parse(const uint8_t* data, std::size_t size);
+
+  // draws rows of layout into strip of packed 4bpp rows placed at x, y on the display (as wide as the layout)
+  void render(uint8_t* strip, uint32_t x, uint32_t y, uint32_t width, uint32_t height) const;
+
+  uint16_t x() const;
+  uint16_t y() const;
+  uint16_t width() const;
+  uint16_t height() const;
+  const char* error() const;
+
+private:
+  bool fail(const char* error);
+};
@@ -1,4 +1,12 @@
+#include "arena.hpp"
+#include "broker_address.hpp"
+#include "chunk_ring.hpp"
+#include "clock.hpp"
+#include "dither.hpp"
 #include "dma_buffer.hpp"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_sntp.h"
 #include "esp_sleep.h"
 #include "essentials/config.hpp"
 #include "essentials/device_info.hpp"
@@ -6,15 +14,39 @@
 #include "essentials/mqtt.hpp"
 #include "essentials/settings_server.hpp"
 #include "essentials/wifi.hpp"
+#include "font_lato20.hpp"
+#include "frame_hash.hpp"
+#include "frame_store.hpp"
+#include "interlaced_band_writer.hpp"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "jpeg_decoder.hpp"
+#include "layout.hpp"
+#include "packed_frame.hpp"
 #include "pngle/pngle.h"
 #include "power.hpp"
+#include "psram_buffer.hpp"
+#include "shown_strips.hpp"
 #include "simple_logger.hpp"
+#include "sprites.hpp"
+#include "strip_packer.hpp"
+#include "strip_uploader.hpp"
+#include "tls_session.hpp"
+#include "tone_curve.hpp"
 #include "waveshare_it8951.hpp"
+#include "wifi_cache.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <sys/time.h>
 
 namespace es = essentials;
 using namespace std::chrono_literals;
@@ -24,6 +56,36 @@ const char* TAG_APP = "app";
 extern const uint8_t mqttCertBegin[] asm("_binary_cert_pem_start");
 extern const uint8_t mqttCertEnd[] asm("_binary_cert_pem_end");
 
+// hashes of last drawn region payloads survive deep sleep (on power loss all regions are drawn again)
+struct RegionState {
+  uint32_t topicHash;
+  uint32_t payloadHash;
+  uint32_t versionHash; // of "<topic>/version" payload announced with drawn image, 0 = unknown
+};
+
+constexpr std::size_t maxRegions = 8;
+RTC_DATA_ATTR RegionState regionStates[maxRegions];
+// strips of last shown image of every topic, strips which didn't change aren't uploaded
+RTC_DATA_ATTR ShownStrips::State shownStripStates[maxRegions];
+
+// status shown by overlay icons is known only after the image is flushed, so icons show state of previous wakes
+struct WakeState {
+  enum class Failure : uint8_t { NONE, TIMEOUT, DECODE };
+
+  uint32_t unchangedWakes;
+  Failure failure;
+};
+
+RTC_DATA_ATTR WakeState wakeState;
+// time of network wakes, local wakes between them only redraw the clock
+RTC_DATA_ATTR LocalClock::State clockState;
+// DHCP lease reused as static IP by following wakes
+RTC_DATA_ATTR WifiCache::Lease wifiLease;
+// TLS session of MQTT broker resumed by the next wake
+RTC_DATA_ATTR TlsSessionCache::State tlsSession;
+// address of MQTT broker connected without DNS lookup by following wakes
+RTC_DATA_ATTR BrokerAddressCache::State brokerAddress;
+
 struct App {
   const int64_t startTime = esp_timer_get_time();
   es::DeviceInfo deviceInfo{};
@@ -35,6 +97,19 @@ struct App {
   es::Config::Value<std::string> vComDefault = config.get<std::string>("vcom", "-1.8");
   es::Config::Value<std::string> adcCalibA = config.get<std::string>("adcA", "49505");
   es::Config::Value<std::string> adcCalibB = config.get<std::string>("adcB", "269");
+  es::Config::Value<std::string> ditherDefault = config.get<std::string>("dither", "none");
+  es::Config::Value<std::string> toneGamma = config.get<std::string>("gamma", "1.0");
+  es::Config::Value<std::string> toneBlackPoint = config.get<std::string>("black", "0");
+  es::Config::Value<std::string> toneWhitePoint = config.get<std::string>("white", "255");
+  es::Config::Value<std::string> toneCurvePoints = config.get<std::string>("curve", "");
+  es::Config::Value<std::string> regionNames = config.get<std::string>("regions", "");
+  es::Config::Value<std::string> groupName = config.get<std::string>("group", "");
+  es::Config::Value<std::string> groupViewport = config.get<std::string>("viewport", "");
+  es::Config::Value<std::string> contentSource = config.get<std::string>("source", "image");
+  es::Config::Value<std::string> versionTopics = config.get<std::string>("version", "off");
+  es::Config::Value<std::string> clockSetting = config.get<std::string>("clock", "");
+  es::Config::Value<std::string> clockSyncMinutes = config.get<std::string>("sync", "10");
+  es::Config::Value<std::string> timeZone = config.get<std::string>("tz", "UTC0");
 
   es::Esp32Storage mqttStorage{"mqtt"};
   es::Config mqttConfig{mqttStorage};
@@ -43,7 +118,14 @@ struct App {
   es::Config::Value<std::string> mqttPass = mqttConfig.get<std::string>("pass", "");
 
   es::Wifi wifi{};
+  WifiCache wifiCache{wifiLease};
+  BrokerAddressCache brokerAddressCache{brokerAddress};
+  TlsSessionCache tlsSessionCache{tlsSession, brokerAddressCache};
+  int64_t wifiConnectTime{};
+  std::atomic<bool> isMqttConnected{};
   std::unique_ptr<es::Mqtt> mqtt{};
+  // NOTE topics are subscribed by main, MQTT (version topics) and decode (full frame topics) tasks
+  std::mutex subsMutex{};
   std::vector<std::unique_ptr<es::Mqtt::Subscription>> subs{};
   Power power{adcCalibA, adcCalibB};
   float batteryVoltage{};
@@ -61,29 +143,174 @@ struct App {
       {"VCom", vComDefault},
       {"ADC calib A", adcCalibA},
       {"ADC calib B", adcCalibB},
+      {"Dither (none, floyd-steinberg, atkinson, bayer)", ditherDefault},
+      {"Gamma", toneGamma},
+      {"Black point (0-255)", toneBlackPoint},
+      {"White point (0-255)", toneWhitePoint},
+      {"Tone curve (16 grays, overrides gamma)", toneCurvePoints},
+      {"Regions (comma separated)", regionNames},
+      {"Group image (shared by video wall)", groupName},
+      {"Group viewport (x,y,width,height)", groupViewport},
+      {"Content (image, layout)", contentSource},
+      {"Version topics (on, off)", versionTopics},
+      {"Clock (x,y,scale, empty = off)", clockSetting},
+      {"Clock network interval (minutes)", clockSyncMinutes},
+      {"Time zone (POSIX TZ)", timeZone},
     }};
 
+  enum class ImageFormat { PNG, JPEG, PACKED_FRAME, LAYOUT };
+
+  struct Rect {
+    uint32_t x;
+    uint32_t y;
+    uint32_t width;
+    uint32_t height;
+  };
+
+  // "image" topic, or "image/region/<name>" topics when regions are configured
+  struct ImageTopic {
+    std::string topic;
+    std::string fullFrameTopic;
+    bool drawsOnlyChanges;
+    bool isReceived;
+    bool isFullFrameSubscribed;
+    bool isVersionReceived;
+    uint32_t versionHash; // 0 when version topics are off
+  };
+
+  // part of received chunk as large as decode buffer
+  struct Piece {
+    const uint8_t* data;
+    uint32_t size;
+    uint32_t offset; // in message
+    uint32_t totalLength; // of message
+    std::size_t topicIndex;
+    ChunkRing::Kind kind;
+  };
+
+  ImageFormat imageFormat{ImageFormat::PNG};
   pngle_t* pngle = nullptr;
+  JpegDecoder jpegDecoder{};
+  Layout layout{};
+  std::vector<uint8_t> layoutData{};
+  PackedFrameDecoder packedFrameDecoder{
+    [this](const PackedFrame::Header& header) { return beginPackedFrame(header); },
+    [this](const uint8_t* data, std::size_t size) {
+      writePackedBytes(size, [&](auto it, std::size_t n) {
+        if (isDeltaFrame) {
+          std::transform(it, it + n, data, it, std::bit_xor<uint8_t>{});
+        } else {
+          std::copy_n(data, n, it);
+        }
+        data += n;
+      });
+    },
+    [this](uint8_t value, std::size_t count) {
+      writePackedBytes(count, [&](auto it, std::size_t n) {
+        if (!isDeltaFrame) {
+          std::fill_n(it, n, value);
+        } else if (value != 0) {
+          std::for_each(it, it + n, [value](uint8_t& byte) { byte ^= value; });
+        }
+      });
+    }};
+  ToneCurve::Table toneCurve{ToneCurve::identity()};
+  Ditherer ditherer{};
+  Ditherer::Mode ditherMode{Ditherer::Mode::NONE};
+  std::string pngChunk{};
+  FrameStore frameStore{};
+  FrameHash frameHash{};
+  bool isDeltaFrame = false;
+  bool isStoringBaseFrame = false;
+  uint32_t expectedBaseHash{};
+  bool needsFullFrame = false;
+  std::vector<ImageTopic> imageTopics{};
+  std::vector<Rect> changedRects{};
+  Rect viewport{}; // of group image, width 0 when the device has own image
+  FrameHash payloadHash{};
+  ShownStrips shownStrips{};
+  uint32_t heldStrips = 0;
+  uint32_t skippedDownloads = 0;
+  bool isImageDecoded = false;
+  bool hasNewContent = false;
+  bool hasImageError = false;
+  std::vector<Overlay> overlays{};
+  std::vector<TextOverlay> textOverlays{};
   bool timedOut = false;
+  std::optional<LocalClock::Placement> clockPlacement{};
+  uint32_t clockInterval{};
   WaveshareIT8951 display{WaveshareIT8951::Pins{}, power};
-  DmaBuffer& pixelBuffer{display.pixelBuffer()};
+  // NOTE strips are decoded into own buffer, display pixel buffer belongs to the upload task meanwhile
+  std::vector<uint8_t> pixelBuffer = std::vector<uint8_t>(display.pixelBuffer().size());
+  StripUploader uploader{display, uploadTaskPriority, appCore};
+  InterlacedBandWriter interlacedWriter{pixelBuffer.data(),
+    pixelBuffer.size(),
+    // NOTE band rows live at the beginning of pixel buffer
+    [this](uint16_t y, uint8_t*) { loadImageRow(y); },
+    [this](uint16_t y, uint16_t height, const uint8_t*) { writeStrip(y, height); }};
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+  // NOTE mirror of display memory, it doesn't survive deep sleep
+  PsramBuffer frame = PsramBuffer(displayWidth * displayHeight / pixelsToByteRatio, 0xff);
+#endif
+  StripPacker<4> stripPacker{pixelBuffer.data(), pixelBuffer.size(), [this](uint32_t y, uint32_t) {
+    currentBufferOffset = y * (imageWidth / pixelsToByteRatio);
+    flushPixelBuffer();
+  }};
+  bool isInterlaced = false;
+  bool isDisplayDrawn = false;
+  std::mutex imageMutex{};
+  ChunkRing chunkRing{16 * 1024};
+  std::vector<uint8_t> decodeChunk = std::vector<uint8_t>(2048);
+  ChunkRing::Header receivedChunk{};
+  uint32_t receivedChunkConsumed{};
+  bool hasReceivedChunk = false;
+  std::optional<Piece> pendingPiece{};
   uint32_t currentBufferOffset{};
+  uint32_t packedBytesWritten{};
+  uint32_t imageX{};
+  uint32_t imageY{};
   uint32_t imageWidth{};
   uint32_t imageHeight{};
+  bool isImageRejected = false;
+  int64_t decodeTime{};
+  std::atomic<int64_t> firstChunkTime{};
+  std::atomic<int64_t> handoffTime{};
+  int64_t lastChunkTime{};
+  int64_t mqttConnectStartTime{};
   float vcom{};
 
   static constexpr uint32_t pixelsToByteRatio = 2; // 4 bits per pixel (2 pixels : 1 buffer byte)
   static constexpr uint16_t displayWidth = 1200;
   static constexpr uint16_t displayHeight = 825;
 
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+  static constexpr bool hasPsramFrame = true;
+#else
+  static constexpr bool hasPsramFrame = false;
+#endif
+
+  // network (WiFi, lwIP, MQTT) runs on PRO core (see sdkconfig), decoding and display upload on APP core
+  static constexpr BaseType_t appCore = 1;
+  static constexpr UBaseType_t decodeTaskPriority = 5;
+  static constexpr UBaseType_t uploadTaskPriority = 10;
+
   static constexpr auto sleepTime = 60s;
+  static constexpr uint16_t clockPadding = 8;
+  static constexpr uint32_t staleWakes = 30; // stale marker after 30 minutes without new content
 
   void run() {
     checkBattery();
 
     vcom = std::atof((*vComDefault).c_str());
+    buildToneCurve();
+    setupClock();
+    if (clockPlacement && !LocalClock::isNetworkWakeDue(clockState, std::time(nullptr), clockInterval)) {
+      runLocalWake();
+    }
 
     display.powerUp();
+    const int64_t wifiStartTime = esp_timer_get_time();
+    wifiCache.apply();
     wifi.connect(*ssid, *wifiPass);
 
     logW(TAG_APP, "VCom %f", vcom);
@@ -95,6 +322,8 @@ struct App {
       tryCount++;
       vTaskDelay(pdMS_TO_TICKS(10));
     }
+    wifiConnectTime = esp_timer_get_time() - wifiStartTime;
+    if (wifi.isConnected()) wifiCache.store();
 
     auto info = display.info();
     logW(TAG_APP,
@@ -110,13 +339,25 @@ struct App {
 
     if (!wifi.isConnected()) {
       logE(TAG_APP, "Couldn't connect to the wifi. Starting WiFi AP with settings server.");
+      wifiCache.invalidate();
       wifi.startAccessPoint("esp32", "12345678", es::Wifi::Channel::Channel5);
+      // 192.168.4.1 is default IP of ESP-IDF access point
+      drawTextBox(0,
+        displayHeight - 2 * fonts::lato20.lineHeight - 16,
+        600,
+        2 * fonts::lato20.lineHeight + 16,
+        {TextOverlay::layout(fonts::lato20, "WiFi not connected, settings: WiFi esp32 (12345678)", 8, 8),
+          TextOverlay::layout(fonts::lato20, "http://192.168.4.1", 8, 8 + fonts::lato20.lineHeight)});
+      display.disconnect();
       while (true) {
         logW(TAG_APP, "Waiting for configuration...");
         vTaskDelay(pdMS_TO_TICKS(1000));
       }
     }
 
+    setupOverlays();
+    if (clockPlacement) startTimeSync();
+
     auto mqttCert =
       std::string_view{reinterpret_cast<const char*>(mqttCertBegin), std::size_t(mqttCertEnd - mqttCertBegin)};
     std::string mqttPrefix = "esp32/" + deviceInfo.uniqueId();
@@ -127,6 +368,9 @@ struct App {
     es::Mqtt::ConnectionInfo mqttInfo{url, mqttCert, user, pass};
     es::Mqtt::LastWillMessage lastWill{"last/will", "Bye", es::Mqtt::Qos::Qos0, false};
 
+    // NOTE connect time is dominated by TLS handshake (TCP and MQTT CONNECT take a round trip each)
+    tlsSessionCache.begin(url);
+    mqttConnectStartTime = esp_timer_get_time();
     mqtt = std::make_unique<es::Mqtt>(
       mqttInfo,
       std::string_view{mqttPrefix},
@@ -134,59 +378,768 @@ struct App {
       lastWill,
       [this]() {
         logI(TAG_APP, "MQTT is connected!");
+        isMqttConnected = true;
         publishStartupDeviceInfo();
       },
-      []() { logI(TAG_APP, "MQTT is disconnected!"); },
+      [this]() {
+        logI(TAG_APP, "MQTT is disconnected!");
+        // client reconnects by itself, connect time of the reconnect is published
+        mqttConnectStartTime = esp_timer_get_time();
+      },
       1024 * 30);
 
-    pngle = pngle_new();
-    pngle_set_user_data(pngle, this);
+    startDecodeTask();
+    if (clockPlacement) subscribeScheduleTopic();
+    subscribeImageTopics();
+    if (imageTopics.empty()) {
+      logE(TAG_APP, "No image topic to wait for");
+      std::lock_guard lock{imageMutex};
+      goToSleep();
+    }
 
-    pngle_set_init_callback(pngle, [](pngle_t* pngle, uint32_t w, uint32_t h) {
-      auto app = static_cast<App*>(pngle_get_user_data(pngle));
-      app->setImageDimension(w, h);
-    });
+    // subscribe to "ping" topic and react to it by sending "pong" message back
+    keepSubscription(mqtt->subscribe("ping", es::Mqtt::Qos::Qos0, [this](const es::Mqtt::Data& chunk) {
+      logI(TAG_APP, "got ping message");
+      mqtt->publish("pong", chunk.data, es::Mqtt::Qos::Qos0, false);
+    }));
 
-    pngle_set_draw_callback(pngle, [](pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
-      auto app = static_cast<App*>(pngle_get_user_data(pngle));
-      app->drawPixel(x, y, w, h, rgba);
-    });
+    // 20s timeout for sleeping
+    vTaskDelay(pdMS_TO_TICKS(20000));
+    timedOut = true;
+    chunkRing.close();
+
+    // NOTE the lock is held through sleep, decode task mustn't decode chunks left in the ring into disconnected display
+    std::lock_guard lock{imageMutex};
+    if (isInterlaced && !isImageDecoded && interlacedWriter.writtenBands() > 0) {
+      logW(TAG_APP, "drawing preview of unfinished interlaced image");
+      interlacedWriter.flush();
+      changedRects.push_back({imageX, imageY, imageWidth, imageHeight});
+    }
+    if (!isDisplayDrawn && (!changedRects.empty() || isClockShown())) drawDisplay();
 
-    subs.emplace_back(mqtt->subscribe("image", es::Mqtt::Qos::Qos0, [this](const es::Mqtt::Data& chunk) {
-      logI(TAG_APP, "got image data, size: %d", chunk.data.size());
+    goToSleep();
+  }
 
-      if (pngle != nullptr) {
-        int fedBytes = pngle_feed(pngle, chunk.data.data(), chunk.data.size());
-        if (fedBytes < 0) {
-          logE(TAG_APP, "pngle error: %s", pngle_error(pngle));
-        }
-      }
+  void keepSubscription(std::unique_ptr<es::Mqtt::Subscription> subscription) {
+    std::lock_guard lock{subsMutex};
+    subs.push_back(std::move(subscription));
+  }
 
-      const auto isLastChunk = chunk.offset + chunk.data.size() == chunk.totalLength;
-      if (isLastChunk) {
-        const auto elapsedTime = esp_timer_get_time() - startTime;
-        logI(TAG_APP, "elapsed time to image download and decode: %lld ms", elapsedTime / 1000);
+  void subscribeImageTopics() {
+    // NOTE topics have to stay in place once subscribed
+    imageTopics.reserve(maxRegions);
 
-        pngle_destroy(pngle);
-        pngle = nullptr;
+    const std::string group = *groupName;
+    if (!group.empty()) {
+      subscribeGroupImageTopic(group);
+      return;
+    }
+
+    const std::string names = *regionNames;
+    if (names.empty()) {
+      // layout topic carries drawing commands rendered by the device instead of image
+      const std::string topic = *contentSource == "layout" ? "layout" : "image";
+      imageTopics.push_back({topic, topic + "/full", false});
+    }
+
+    for (std::size_t begin = 0; begin < names.size();) {
+      const std::size_t end = std::min(names.find(',', begin), names.size());
+      const std::string name = names.substr(begin, end - begin);
+      begin = end + 1;
 
-        timedOut = false;
-        goToSleep();
+      if (name.empty()) continue;
+      if (imageTopics.size() == maxRegions) {
+        logE(TAG_APP, "Too many regions, ignoring region %s", name.c_str());
+        continue;
       }
+      const std::string topic = "image/region/" + name;
+      imageTopics.push_back({topic, topic + "/full", true});
+    }
+
+    for (std::size_t i = 0; i < imageTopics.size(); i++) subscribeContentTopic(i);
+  }
+
+  // video wall: all devices share one large image, every one decodes and draws only its viewport (at 0, 0)
+  void subscribeGroupImageTopic(const std::string& group) {
+    if (!(*regionNames).empty()) logW(TAG_APP, "Regions are ignored with group image");
+    // NOTE panel of a wall with invalid viewport would show wrong part of the image, error marker shows instead
+    if (!parseViewport(*groupViewport)) {
+      logE(TAG_APP, "Invalid viewport '%s', group image isn't subscribed", (*groupViewport).c_str());
+      hasImageError = true;
+      return;
+    }
+
+    const std::string topic = "image/group/" + group;
+    imageTopics.push_back({topic, topic + "/full", false});
+    subscribeContentTopic(0);
+  }
+
+  // "x,y,width,height", x multiple of 8 keeps interlaced passes 2, 4 and 6 off the left edge of the viewport
+  bool parseViewport(const std::string& text) {
+    unsigned x = 0, y = 0, width = 0, height = 0;
+    char rest = 0;
+    if (std::sscanf(text.c_str(), "%u,%u,%u,%u%c", &x, &y, &width, &height, &rest) != 4) return false;
+    if (x % 8 != 0 || width % 4 != 0 || width == 0 || height == 0) return false;
+    if (width > displayWidth || height > displayHeight) return false;
+
+    viewport = {x, y, width, height};
+    logI(TAG_APP, "group image viewport %d, %d, %dx%d", x, y, width, height);
+    return true;
+  }
+
+  // with version topics the image is subscribed only when its version differs from the drawn one
+  void subscribeContentTopic(std::size_t index) {
+    if (*versionTopics != "on") {
+      subscribeImageTopic(imageTopics[index].topic, index);
+      return;
+    }
+
+    const std::string topic = imageTopics[index].topic + "/version";
+    keepSubscription(mqtt->subscribe(topic, es::Mqtt::Qos::Qos0, [this, index](const es::Mqtt::Data& chunk) {
+      if (chunk.offset != 0) return;
+
+      FrameHash version{};
+      version.update(reinterpret_cast<const uint8_t*>(chunk.data.data()), chunk.data.size());
+      onImageVersion(index, version.value);
     }));
+  }
 
-    // subscribe to "ping" topic and react to it by sending "pong" message back
-    subs.emplace_back(mqtt->subscribe("ping", es::Mqtt::Qos::Qos0, [this](const es::Mqtt::Data& chunk) {
-      logI(TAG_APP, "got ping message");
-      mqtt->publish("pong", chunk.data, es::Mqtt::Qos::Qos0, false);
+  // "<topic>/version" is tiny retained content hash (any string) published by the server with every image
+  // NOTE runs on MQTT task, decode task reads version fields only after the image comes through the chunk ring
+  void onImageVersion(std::size_t index, uint32_t version) {
+    auto& imageTopic = imageTopics[index];
+    // NOTE version republished during the wake is left for the next one
+    if (imageTopic.isVersionReceived) return;
+    imageTopic.isVersionReceived = true;
+    imageTopic.versionHash = version;
+
+    const auto& state = regionStates[index];
+    if (state.topicHash != hashTopic(imageTopic.topic) || state.versionHash != version) {
+      logI(TAG_APP, "%s version %08x is new, downloading", imageTopic.topic.c_str(), version);
+      subscribeImageTopic(imageTopic.topic, index);
+      return;
+    }
+
+    logI(TAG_APP, "%s version %08x is drawn, download skipped", imageTopic.topic.c_str(), version);
+    // drawing and sleep stay on the decode task
+    const ChunkRing::Header header{static_cast<uint32_t>(index), 0, 0, 0, ChunkRing::Kind::UNCHANGED};
+    if (!chunkRing.push(header, nullptr)) logW(TAG_APP, "dropped unchanged %s", imageTopic.topic.c_str());
+  }
+
+  void onImageUnchanged(std::size_t topicIndex) {
+    std::lock_guard lock{imageMutex};
+    skippedDownloads++;
+    imageTopics[topicIndex].isReceived = true;
+    finishIfEverythingReceived();
+  }
+
+  // MQTT task only hands chunks over to the decode task (waits while the ring is full)
+  void subscribeImageTopic(const std::string& topic, std::size_t index) {
+    keepSubscription(mqtt->subscribe(topic, es::Mqtt::Qos::Qos0, [this, index](const es::Mqtt::Data& chunk) {
+      const ChunkRing::Header header{static_cast<uint32_t>(index),
+        static_cast<uint32_t>(chunk.offset),
+        static_cast<uint32_t>(chunk.totalLength),
+        static_cast<uint32_t>(chunk.data.size())};
+      const int64_t pushStartTime = esp_timer_get_time();
+      if (firstChunkTime == 0) firstChunkTime = pushStartTime;
+      const bool isPushed = chunkRing.push(header, reinterpret_cast<const uint8_t*>(chunk.data.data()));
+      handoffTime += esp_timer_get_time() - pushStartTime;
+      if (!isPushed) logW(TAG_APP, "dropped chunk %d of %d", header.offset, header.totalLength);
     }));
+  }
 
-    // 20s timeout for sleeping
-    vTaskDelay(pdMS_TO_TICKS(20000));
-    timedOut = true;
+  // retained "schedule" topic: time (seconds since epoch) of the next content change, clock goes to network then
+  // NOTE it's subscribed before image topics, so it arrives before the last image sends the device to sleep
+  void subscribeScheduleTopic() {
+    clockState.nextContentTime = 0;
+    keepSubscription(mqtt->subscribe("schedule", es::Mqtt::Qos::Qos0, [](const es::Mqtt::Data& chunk) {
+      if (chunk.offset != 0 || chunk.data.size() != chunk.totalLength || chunk.data.size() > 20) return;
+
+      const std::string text{chunk.data.data(), chunk.data.size()};
+      const int64_t time = std::atoll(text.c_str());
+      clockState.nextContentTime = time > std::time(nullptr) ? time : 0;
+      logI(TAG_APP, "next content change at %lld", clockState.nextContentTime);
+    }));
+  }
+
+  // decoding, display upload, refresh and sleep run in own task on APP core, so network reception continues meanwhile
+  void startDecodeTask() {
+    xTaskCreatePinnedToCore([](void* app) { static_cast<App*>(app)->decodeChunks(); },
+      "decodeTask",
+      8192,
+      this,
+      decodeTaskPriority,
+      nullptr,
+      appCore);
+  }
+
+  void decodeChunks() {
+    try {
+      while (true) {
+        const Piece piece = pendingPiece ? *std::exchange(pendingPiece, std::nullopt) : receivePiece();
+        if (piece.kind == ChunkRing::Kind::UNCHANGED) {
+          onImageUnchanged(piece.topicIndex);
+          continue;
+        }
+        onImageChunk(piece.data, piece.size, piece.offset, piece.totalLength, piece.topicIndex);
+      }
+    } catch (const std::exception& e) {
+      logE(TAG_APP, "DECODE EXCEPTION: %s", e.what());
+    } catch (...) {
+      logE(TAG_APP, "UNKNOWN DECODE EXCEPTION");
+    }
+    esp_restart();
+  }
+
+  // blocks until the next piece is received, it's valid until the next call
+  // NOTE chunk is decoded in pieces as large as decode buffer, empty message is one empty piece
+  Piece receivePiece() {
+    if (!hasReceivedChunk) {
+      receivedChunk = chunkRing.receiveHeader();
+      receivedChunkConsumed = 0;
+      hasReceivedChunk = true;
+    }
+
+    const uint32_t size = std::min<uint32_t>(receivedChunk.size - receivedChunkConsumed, decodeChunk.size());
+    chunkRing.receive(decodeChunk.data(), size);
+    const Piece piece{decodeChunk.data(),
+      size,
+      receivedChunk.offset + receivedChunkConsumed,
+      receivedChunk.totalLength,
+      receivedChunk.topicIndex,
+      receivedChunk.kind};
+
+    receivedChunkConsumed += size;
+    hasReceivedChunk = receivedChunkConsumed < receivedChunk.size;
+    return piece;
+  }
+
+  static ImageFormat detectImageFormat(const uint8_t* data, std::size_t size) {
+    if (PackedFrame::isPackedFrame(data, size)) return ImageFormat::PACKED_FRAME;
+    if (JpegDecoder::isJpeg(data, size)) return ImageFormat::JPEG;
+    if (Layout::isLayout(data, size)) return ImageFormat::LAYOUT;
+    return ImageFormat::PNG;
+  }
+
+  void onImageChunk(
+    const uint8_t* data, std::size_t size, uint32_t offset, uint32_t totalLength, std::size_t topicIndex) {
+    std::unique_lock lock{imageMutex};
+    logI(TAG_APP, "got image data, size: %d", size);
+
+    if (offset == 0) {
+      imageFormat = detectImageFormat(data, size);
+      startImage(topicIndex);
+    }
+    payloadHash.update(data, size);
+
+    uint32_t end = offset + size;
+    const auto feedStartTime = esp_timer_get_time();
+    if (needsFullFrame) {
+      // skip rest of delta frame which can't be applied
+    } else if (imageFormat == ImageFormat::PACKED_FRAME) {
+      if (!packedFrameDecoder.feed(data, size)) {
+        logE(TAG_APP, "packed frame error: %s", packedFrameDecoder.error());
+      }
+    } else if (imageFormat == ImageFormat::JPEG) {
+      end = decodeJpeg(data, size, totalLength, lock);
+    } else if (imageFormat == ImageFormat::LAYOUT) {
+      receiveLayout(data, size, end == totalLength);
+    } else if (pngle != nullptr) {
+      int fedBytes = pngle_feed(pngle, data, size);
+      if (fedBytes < 0) {
+        logE(TAG_APP, "pngle error: %s", pngle_error(pngle));
+      }
+    }
+    const auto isLastChunk = end == totalLength;
+    if (isLastChunk) uploader.wait();
+    decodeTime += esp_timer_get_time() - feedStartTime;
+
+    if (isLastChunk) {
+      lastChunkTime = esp_timer_get_time();
+      const auto elapsedTime = esp_timer_get_time() - startTime;
+      logI(TAG_APP, "elapsed time to image download and decode: %lld ms", elapsedTime / 1000);
+      logI(
+        TAG_APP, "time spent in decoder: %lld ms (%s inflate)", decodeTime / 1000, pngle_get_inflate_backend_name());
+
+      destroyPngle();
+
+      auto& imageTopic = imageTopics[topicIndex];
+      if (needsFullFrame && !imageTopic.isFullFrameSubscribed) {
+        logW(TAG_APP, "base frame doesn't match delta frame, waiting for %s", imageTopic.fullFrameTopic.c_str());
+        imageTopic.isFullFrameSubscribed = true;
+        subscribeImageTopic(imageTopic.fullFrameTopic, topicIndex);
+        return;
+      }
+
+      imageTopic.isReceived = true;
+      if (isImageDecoded) {
+        addChangedRect(topicIndex);
+      } else {
+        hasImageError = true;
+      }
+
+      finishIfEverythingReceived();
+    }
+  }
+
+  // draws and goes to sleep once every topic is received (or skipped), image mutex is held
+  void finishIfEverythingReceived() {
+    const bool isEverythingReceived =
+      std::all_of(imageTopics.begin(), imageTopics.end(), [](const auto& topic) { return topic.isReceived; });
+    if (!isEverythingReceived) return;
+
+    chunkRing.close();
+    if (!isDisplayDrawn && (!changedRects.empty() || isClockShown())) drawDisplay();
+
+    timedOut = false;
     goToSleep();
   }
 
+  // TJpgDec pulls its input, so the rest of the message (starting by the first piece) is received here. Image mutex
+  // is released while waiting for the network, as between chunks of other formats. Returns end of consumed message.
+  uint32_t decodeJpeg(const uint8_t* data, uint32_t size, uint32_t totalLength, std::unique_lock<std::mutex>& lock) {
+    uint32_t end = size;
+    int64_t waitTime = 0;
+    const auto read = [&](uint8_t* buffer, std::size_t count) {
+      std::size_t done = 0;
+      while (done < count) {
+        if (size == 0) {
+          if (end == totalLength) break;
+
+          const int64_t waitStartTime = esp_timer_get_time();
+          lock.unlock();
+          const Piece piece = receivePiece();
+          lock.lock();
+          waitTime += esp_timer_get_time() - waitStartTime;
+
+          if (piece.offset != end) {
+            logE(TAG_APP, "JPEG message ended at %d of %d bytes", end, totalLength);
+            pendingPiece = piece;
+            end = totalLength;
+            break;
+          }
+          data = piece.data;
+          size = piece.size;
+          end += piece.size;
+          payloadHash.update(data, size);
+          continue;
+        }
+
+        const std::size_t n = std::min<std::size_t>(count - done, size);
+        if (buffer != nullptr) std::copy_n(data, n, buffer + done);
+        data += n;
+        size -= n;
+        done += n;
+      }
+      return done;
+    };
+
+    const bool isDecoded = jpegDecoder.decode(
+      read,
+      [this](uint32_t width, uint32_t height) { return beginJpegPixels(width, height); },
+      [this](uint32_t y, const uint8_t* gray) { drawGrayRow(y, gray); });
+    if (!isDecoded) logE(TAG_APP, "jpeg error: %s", jpegDecoder.error());
+
+    // rest of the message (eg. after EOI or of rejected image) is skipped
+    while (read(nullptr, decodeChunk.size()) > 0) {
+    }
+
+    // NOTE decode time is measured around the whole message, waiting for network isn't decoding
+    decodeTime -= waitTime;
+    return end;
+  }
+
+  // layout is a few hundred bytes, so it's collected whole and drawn once received
+  void receiveLayout(const uint8_t* data, std::size_t size, bool isLastChunk) {
+    if (!isImageRejected && layoutData.size() + size > Layout::maxSize) {
+      logE(TAG_APP, "layout is larger than %d bytes", Layout::maxSize);
+      isImageRejected = true;
+    }
+    if (isImageRejected) return;
+
+    layoutData.insert(layoutData.end(), data, data + size);
+    if (isLastChunk) drawLayout();
+  }
+
+  void drawLayout() {
+    if (!layout.parse(layoutData.data(), layoutData.size())) {
+      logE(TAG_APP, "layout error: %s", layout.error());
+      return;
+    }
+    if (viewport.width > 0) {
+      logE(TAG_APP, "layout can't be cropped to viewport, group image has to be PNG");
+      return;
+    }
+
+    imageX = layout.x();
+    imageY = layout.y();
+    setImageDimension(layout.width(), layout.height());
+    if (!checkImageRect()) return;
+
+    // strips are rasterized into pixel buffer and go the same way as decoded ones
+    const uint32_t rowSize = imageWidth / pixelsToByteRatio;
+    const uint32_t imageSize = rowSize * imageHeight;
+    for (currentBufferOffset = 0; currentBufferOffset < imageSize; currentBufferOffset += stripCapacity()) {
+      const uint32_t y = currentBufferOffset / rowSize;
+      const uint32_t rows = std::min(stripCapacity() / rowSize, imageHeight - y);
+      layout.render(pixelBuffer.data(), imageX, imageY + y, imageWidth, rows);
+      flushPixelBuffer();
+    }
+    isImageDecoded = true;
+  }
+
+  static uint32_t hashTopic(const std::string& topic) {
+    FrameHash hash{};
+    hash.update(reinterpret_cast<const uint8_t*>(topic.data()), topic.size());
+    return hash.value;
+  }
+
+  void addChangedRect(std::size_t topicIndex) {
+    const auto& imageTopic = imageTopics[topicIndex];
+    const uint32_t topicHash = hashTopic(imageTopic.topic);
+
+    auto& state = regionStates[topicIndex];
+    const bool hasChanged = state.topicHash != topicHash || state.payloadHash != payloadHash.value;
+    state = {topicHash, payloadHash.value, imageTopic.versionHash};
+    hasNewContent = hasNewContent || hasChanged;
+
+    if (imageTopic.drawsOnlyChanges && !hasChanged) {
+      logI(TAG_APP, "%s hasn't changed", imageTopic.topic.c_str());
+      return;
+    }
+
+    // NOTE payload can change while pixels don't (eg. republished image), the panel keeps what it shows
+    shownStripStates[topicIndex] = shownStrips.state();
+    if (shownStrips.isUnchanged()) {
+      logI(TAG_APP, "%s is the same as shown, refresh is skipped", imageTopic.topic.c_str());
+      return;
+    }
+    if (shownStrips.isEnabled()) {
+      const uint32_t top = shownStrips.changedTop();
+      changedRects.push_back({imageX, top, imageWidth, shownStrips.changedBottom() - top});
+      return;
+    }
+    changedRects.push_back({imageX, imageY, imageWidth, imageHeight});
+  }
+
+  // icons are placed from the bottom right corner to the left, they are blended into image strips covering them
+  void setupOverlays() {
+    uint16_t x = displayWidth - sprites::Icon::width;
+    const uint16_t y = displayHeight - sprites::Icon::height;
+    const auto addOverlay = [&](const sprites::Icon& icon) {
+      overlays.push_back({x, y, icon.view()});
+      x -= sprites::Icon::width + 4;
+    };
+
+    const int capacity = ((power.voltageToCapacity(batteryVoltage) - 20) * 7) / 5; // random visualisation adjustment
+    addOverlay(sprites::battery[std::clamp(capacity, 0, 100) / 10]);
+
+    const int rssi = wifi.rssi().value_or(-100);
+    addOverlay(sprites::wifi[rssi >= -55 ? 4 : rssi >= -67 ? 3 : rssi >= -78 ? 2 : rssi >= -89 ? 1 : 0]);
+
+    if (wakeState.unchangedWakes >= staleWakes) addOverlay(sprites::stale);
+    if (wakeState.failure != WakeState::Failure::NONE) addOverlay(sprites::error);
+
+    // status text continues to the left of icons
+    const char* failure = wakeState.failure == WakeState::Failure::TIMEOUT ? "timeout, "
+      : wakeState.failure == WakeState::Failure::DECODE                    ? "decode error, "
+                                                                           : "";
+    const std::string status = failure + std::to_string(power.voltageToCapacity(batteryVoltage)) + "%";
+    auto text = TextOverlay::layout(fonts::lato20, status, 0, displayHeight - fonts::lato20.lineHeight);
+    text.translate(x + sprites::Icon::width - text.width, 0);
+    textOverlays.push_back(std::move(text));
+  }
+
+  // blends status icons and text into pixel buffer strip and submits it to display memory at x, y
+  void sendStrip(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    blendOverlays(overlays, pixelBuffer.data(), x, y, width, height);
+    blendText(textOverlays, pixelBuffer.data(), x, y, width, height);
+    if (!shownStrips.submit(x, y, width, height, pixelBuffer.data())) {
+      heldStrips++;
+      return;
+    }
+    uploader.submit(pixelBuffer.data(), x, y, width, height);
+  }
+
+  // decoded strip (image rows from y) in pixel buffer goes to display memory, or to PSRAM frame
+  void writeStrip(uint32_t y, uint32_t height) {
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+    const uint32_t rowSize = imageWidth / pixelsToByteRatio;
+    for (uint32_t row = 0; row < height; row++) {
+      std::copy_n(pixelBuffer.begin() + row * rowSize, rowSize, frame.begin() + frameOffset(imageX, imageY + y + row));
+    }
+#else
+    sendStrip(imageX, imageY + y, imageWidth, height);
+#endif
+  }
+
+  // image row y goes to the beginning of pixel buffer
+  void loadImageRow(uint32_t y) {
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+    std::copy_n(frame.begin() + frameOffset(imageX, imageY + y), imageWidth / pixelsToByteRatio, pixelBuffer.begin());
+#else
+    uploader.wait();
+    display.readImageRow(imageX, imageY + y, imageWidth);
+    std::copy_n(display.pixelBuffer().begin(), imageWidth / pixelsToByteRatio, pixelBuffer.begin());
+#endif
+  }
+
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+  static uint32_t frameOffset(uint32_t x, uint32_t y) {
+    return (y * displayWidth + x) / pixelsToByteRatio;
+  }
+
+  // sends rectangle of PSRAM frame to display memory in strips as large as pixel buffer
+  void uploadFrameRect(const Rect& rect) {
+    const uint32_t rowSize = rect.width / pixelsToByteRatio;
+    const uint32_t stripHeight = pixelBuffer.size() / rowSize;
+    for (uint32_t y = 0; y < rect.height; y += stripHeight) {
+      const uint32_t rows = std::min(stripHeight, rect.height - y);
+      for (uint32_t row = 0; row < rows; row++) {
+        const auto source = frame.begin() + frameOffset(rect.x, rect.y + y + row);
+        std::copy_n(source, rowSize, pixelBuffer.begin() + row * rowSize);
+      }
+      sendStrip(rect.x, rect.y + y, rect.width, rows);
+    }
+  }
+#endif
+
+  // draws white box with text (positioned relative to the box) on its own, x and width multiple of 4
+  void drawTextBox(uint16_t x,
+    uint16_t y,
+    uint16_t width,
+    uint16_t height,
+    std::vector<TextOverlay> texts,
+    WaveshareIT8951::Waveform waveform = WaveshareIT8951::Waveform::GLD16) {
+    for (auto& text : texts) text.translate(x, y);
+
+    const uint32_t rowSize = width / pixelsToByteRatio;
+    const uint16_t stripHeight = pixelBuffer.size() / rowSize;
+    for (uint16_t row = 0; row < height; row += stripHeight) {
+      const uint16_t rows = std::min<uint16_t>(stripHeight, height - row);
+      std::fill_n(pixelBuffer.begin(), rowSize * rows, 0xff);
+      blendText(texts, pixelBuffer.data(), x, y + row, width, rows);
+      // NOTE DU waveform has no grays, anti-aliased edges are rounded to black or white
+      if (waveform == WaveshareIT8951::Waveform::DU) {
+        std::for_each(pixelBuffer.begin(), pixelBuffer.begin() + rowSize * rows, [](uint8_t& byte) {
+          byte = ((byte & 0x80) != 0 ? 0xf0 : 0) | ((byte & 0x08) != 0 ? 0x0f : 0);
+        });
+      }
+      uploader.submit(pixelBuffer.data(), x, y + row, width, rows);
+    }
+    uploader.wait();
+    display.showImage(x, y, width, height, waveform);
+  }
+
+  void setupClock() {
+    const std::string placement = *clockSetting;
+    if (placement.empty()) return;
+
+    clockPlacement = LocalClock::parsePlacement(placement);
+    if (!clockPlacement) {
+      logE(TAG_APP, "Invalid clock '%s'", placement.c_str());
+      return;
+    }
+    const Rect rect = clockRect();
+    if (rect.x + rect.width > displayWidth || rect.y + rect.height > displayHeight) {
+      logE(TAG_APP, "Clock %d, %d, %dx%d is out of display", rect.x, rect.y, rect.width, rect.height);
+      clockPlacement.reset();
+      return;
+    }
+
+    clockInterval = std::max(std::atoi((*clockSyncMinutes).c_str()), 1);
+    setenv("TZ", (*timeZone).c_str(), 1);
+    tzset();
+  }
+
+  // clock box fits any time of widest digits, x and width multiple of 4
+  Rect clockRect() const {
+    uint8_t digitAdvance = 0;
+    for (char digit = '0'; digit <= '9'; digit++) {
+      if (const auto* glyph = fonts::lato20.find(digit)) digitAdvance = std::max(digitAdvance, glyph->advance);
+    }
+    const auto* colon = fonts::lato20.find(':');
+    const uint32_t scale = clockPlacement->scale;
+    const uint32_t textWidth = (4 * digitAdvance + (colon != nullptr ? colon->advance : 0)) * scale;
+    const uint32_t width = (textWidth + 2 * clockPadding + 3) / 4 * 4;
+    return {clockPlacement->x, clockPlacement->y, width, fonts::lato20.lineHeight * scale + 2 * clockPadding};
+  }
+
+  // time is known since the first SNTP sync
+  bool isClockShown() const {
+    return clockPlacement && clockState.isTimeSet;
+  }
+
+  void drawClock(WaveshareIT8951::Waveform waveform) {
+    const Rect rect = clockRect();
+    const std::string time = LocalClock::format(LocalClock::shownMinute(std::time(nullptr)));
+    logI(TAG_APP, "clock %s", time.c_str());
+    drawTextBox(rect.x,
+      rect.y,
+      rect.width,
+      rect.height,
+      {TextOverlay::layout(fonts::lato20, time, clockPadding, clockPadding, 0, clockPlacement->scale)},
+      waveform);
+  }
+
+  // only the clock is redrawn with fast waveform, WiFi stays off
+  [[noreturn]] void runLocalWake() {
+    logI(TAG_APP, "local wake %d since network wake", clockState.localWakes + 1);
+    display.powerUp();
+    display.connect(vcom);
+    drawClock(WaveshareIT8951::Waveform::DU);
+    display.disconnect();
+
+    clockState.localWakes++;
+    esp_sleep_enable_timer_wakeup(sleepDuration());
+    esp_deep_sleep_start();
+  }
+
+  // SNTP runs in background during network wake, RTC keeps the time in deep sleep
+  void startTimeSync() {
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_setservername(0, "pool.ntp.org");
+    sntp_set_time_sync_notification_cb([](timeval*) { clockState.isTimeSet = true; });
+    sntp_init();
+  }
+
+  // clock wakes at the beginning of every minute, otherwise the device sleeps fixed time
+  int64_t sleepDuration() const {
+    if (!clockPlacement) return std::chrono::microseconds{sleepTime}.count();
+
+    timeval now{};
+    gettimeofday(&now, nullptr);
+    return LocalClock::sleepTime(int64_t{now.tv_sec} * 1'000'000 + now.tv_usec);
+  }
+
+  void startImage(std::size_t topicIndex) {
+    currentBufferOffset = 0;
+    packedBytesWritten = 0;
+    frameHash = {};
+    isDeltaFrame = false;
+    isStoringBaseFrame = false;
+    needsFullFrame = false;
+    isInterlaced = false;
+    isImageRejected = false;
+    isImageDecoded = false;
+    payloadHash = {};
+    imageX = 0;
+    imageY = 0;
+
+    packedFrameDecoder.reset();
+    layoutData.clear();
+    ditherMode = Ditherer::parseMode(*ditherDefault);
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+    // NOTE strips of PSRAM frame are uploaded only after all images are decoded
+    shownStrips.disable();
+#else
+    shownStrips.begin(shownStripStates[topicIndex]);
+#endif
+
+    if (imageFormat == ImageFormat::PNG) {
+      destroyPngle();
+      pngle = pngle_new_with_allocator(&pngleAllocator);
+      pngle_set_user_data(pngle, this);
+      pngle_set_viewport(pngle, viewport.x, viewport.y, viewport.width, viewport.height);
+
+      pngle_set_init_callback(pngle, [](pngle_t* pngle, uint32_t w, uint32_t h) {
+        auto app = static_cast<App*>(pngle_get_user_data(pngle));
+        app->setImageDimension(w, h);
+      });
+
+      pngle_set_draw_callback(pngle,
+        [](pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
+          auto app = static_cast<App*>(pngle_get_user_data(pngle));
+          app->drawPixel(x, y, w, h, rgba);
+        });
+
+      pngle_set_done_callback(pngle, [](pngle_t* pngle) {
+        auto app = static_cast<App*>(pngle_get_user_data(pngle));
+        app->finishInterlacedImage();
+      });
+
+      pngle_set_chunk_callback(pngle,
+        [](pngle_t* pngle, uint32_t type, const uint8_t* data, size_t len, uint32_t offset, uint32_t chunkLength) {
+          auto app = static_cast<App*>(pngle_get_user_data(pngle));
+          app->readPngChunk(type, data, len, offset, chunkLength);
+        });
+    }
+  }
+
+  // pngle state is allocated from decoder arena, which is released at once with it
+  static constexpr pngle_allocator_t pngleAllocator{
+    [](void*, std::size_t n, std::size_t size) {
+      void* p = decoderArena().allocateOrHeap(n * size, MALLOC_CAP_8BIT);
+      if (p != nullptr) std::memset(p, 0, n * size);
+      return p;
+    },
+    [](void*, void* p) { decoderArena().releaseOrHeap(p); },
+    nullptr};
+
+  void destroyPngle() {
+    pngle_destroy(pngle);
+    pngle = nullptr;
+    decoderArena().reset();
+  }
+
+  // chunks are read before IDAT:
+  // - tEXt chunk with "dither" keyword selects dither mode of the image, eg. "dither\0atkinson"
+  // - oFFs chunk (in pixels) places the image at offset on the display
+  void readPngChunk(uint32_t type, const uint8_t* data, size_t len, uint32_t offset, uint32_t chunkLength) {
+    constexpr uint32_t textChunkType = 0x74455874; // tEXt
+    constexpr uint32_t offsetChunkType = 0x6f464673; // oFFs
+    constexpr uint32_t maxChunkLength = 64;
+    if ((type != textChunkType && type != offsetChunkType) || chunkLength > maxChunkLength) return;
+
+    if (offset == 0) pngChunk.clear();
+    pngChunk.append(reinterpret_cast<const char*>(data), len);
+    if (offset + len != chunkLength) return;
+
+    if (type == offsetChunkType) {
+      readPngOffset();
+    } else {
+      readPngText();
+    }
+  }
+
+  void readPngOffset() {
+    if (viewport.width > 0) {
+      logW(TAG_APP, "oFFs chunk of group image is ignored, viewport is drawn at 0, 0");
+      return;
+    }
+
+    constexpr std::size_t offsetChunkLength = 9;
+    constexpr uint8_t pixelUnit = 0;
+    if (pngChunk.size() != offsetChunkLength || pngChunk[8] != pixelUnit) {
+      logE(TAG_APP, "oFFs chunk has to be in pixels");
+      return;
+    }
+
+    const auto readInt32 = [this](std::size_t i) {
+      const auto bytes = reinterpret_cast<const uint8_t*>(pngChunk.data() + i);
+      return static_cast<int32_t>((bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3]);
+    };
+    const int32_t x = readInt32(0);
+    const int32_t y = readInt32(4);
+    if (x < 0 || y < 0 || x > displayWidth || y > displayHeight) {
+      logE(TAG_APP, "oFFs %d, %d is out of display", x, y);
+      isImageRejected = true;
+      return;
+    }
+
+    imageX = x;
+    imageY = y;
+  }
+
+  void readPngText() {
+    const std::string_view text{pngChunk};
+    const auto separator = text.find('\0');
+    if (separator == std::string_view::npos || text.substr(0, separator) != "dither") return;
+
+    ditherMode = Ditherer::parseMode(text.substr(separator + 1), ditherMode);
+    logI(TAG_APP, "image dither mode: %s", Ditherer::modeName(ditherMode));
+  }
+
   void checkBattery() {
     auto [v, raw] = power.readBatteryVoltage();
     batteryVoltage = v;
@@ -202,117 +1155,230 @@ struct App {
     }
   }
 
+  void buildToneCurve() {
+    const std::string curve = *toneCurvePoints;
+    if (!curve.empty()) {
+      if (auto table = ToneCurve::fromCurve(curve)) {
+        toneCurve = *table;
+        return;
+      }
+      logE(TAG_APP, "Invalid tone curve '%s', using gamma", curve.c_str());
+    }
+
+    const auto toGray = [](const std::string& value) {
+      return static_cast<uint8_t>(std::clamp(std::atoi(value.c_str()), 0, 255));
+    };
+    const float gamma = std::atof((*toneGamma).c_str());
+    toneCurve = ToneCurve::fromGamma(gamma, toGray(*toneBlackPoint), toGray(*toneWhitePoint));
+  }
+
   void setImageDimension(uint32_t w, uint32_t h) {
     imageWidth = w;
     imageHeight = h;
   }
 
-  void drawPixel(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
-    uint32_t pixelIndex = y * imageWidth + x;
-    uint32_t bufferIndex = pixelIndex / pixelsToByteRatio - currentBufferOffset;
+  bool beginJpegPixels(uint32_t width, uint32_t height) {
+    if (viewport.width > 0) {
+      logE(TAG_APP, "JPEG can't be cropped to viewport, group image has to be PNG");
+      isImageRejected = true;
+      return false;
+    }
 
-    if (bufferIndex >= pixelBuffer.size()) {
-      flushPixelBuffer();
+    setImageDimension(width, height);
+    beginPixels(false);
+    return !isImageRejected;
+  }
 
-      currentBufferOffset += pixelBuffer.size();
-      bufferIndex = pixelIndex / pixelsToByteRatio - currentBufferOffset;
+  // row of non-interlaced image in raster order
+  void drawGrayRow(uint32_t y, const uint8_t* gray) {
+    if (isImageRejected) return;
+
+    for (uint32_t x = 0; x < imageWidth; x++) {
+      if (stripPacker.push(ditherer.quantize(x, y, toneCurve[gray[x]]))) {
+        ditherer.end();
+        isImageDecoded = true;
+      }
     }
+  }
+
+  void drawPixel(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
+    if (x == 0 && y == 0) beginPngPixels();
+    if (isImageRejected) return;
 
     // NOTE since the display is greyscale, we only need one color (incoming image is/should be grayscale)
-    if ((pixelIndex % 2) == 0) {
-      pixelBuffer[bufferIndex] = (rgba[0] & 0xf0);
-    } else {
-      pixelBuffer[bufferIndex] |= (rgba[0] & 0xf0) >> 4;
+    const uint8_t level = ditherer.quantize(x, y, toneCurve[rgba[0]]);
+    if (isInterlaced) {
+      interlacedWriter.draw(x, y, w, h, level);
+      return;
     }
 
-    if (pixelIndex == imageWidth * imageHeight - 1) {
-      flushPixelBuffer();
-      drawDisplay();
+    if (stripPacker.push(level)) {
+      ditherer.end();
+      isImageDecoded = true;
     }
   }
 
-  void flushPixelBuffer() {
-    // NOTE this code heavily rely on having buffer size multiply of image size
-    logI(TAG_APP, "flushing pixel buffer %d", currentBufferOffset);
+  void beginPngPixels() {
+    beginPixels(pngle_get_ihdr(pngle)->interlace != 0);
+  }
 
-    const uint32_t pixelOffset = currentBufferOffset * pixelsToByteRatio;
+  void beginPixels(bool interlaced) {
+    if (!isImageRejected && !checkImageRect()) isImageRejected = true;
+    if (isImageRejected) return;
 
-    const uint16_t x = pixelOffset % displayWidth;
-    const uint16_t y = pixelOffset / displayWidth;
+    // NOTE interlaced pixels don't come in raster order, they are drawn band by band straight to display memory
+    isInterlaced = interlaced;
+    if (isInterlaced) {
+      // bands are merged with display memory, so none of them can be held back
+      shownStrips.disable();
+      interlacedWriter.begin(imageWidth);
+    } else {
+      stripPacker.begin(imageWidth, imageHeight);
+    }
 
-    const uint16_t width = displayWidth;
-    const uint16_t height = (pixelBuffer.size() * pixelsToByteRatio) / displayWidth;
+    auto mode = ditherMode;
+    const bool isErrorDiffusion = mode == Ditherer::Mode::FLOYD_STEINBERG || mode == Ditherer::Mode::ATKINSON;
+    if (isErrorDiffusion && isInterlaced) {
+      // interlaced passes don't come in row-major order, ordered dither doesn't care
+      mode = Ditherer::Mode::BAYER;
+    }
 
-    display.sendImage(x, y, width, height);
+    logI(TAG_APP, "dithering with %s", Ditherer::modeName(mode));
+    ditherer.begin(mode, imageWidth);
   }
 
-  void drawDisplay() {
-    logW(TAG_APP, "drawing display");
+  void finishInterlacedImage() {
+    if (!isInterlaced || isImageRejected) return;
 
-    uint16_t capacity = ((power.voltageToCapacity(batteryVoltage) - 20) * 7) / 5; // random visualisation adjustment
+    ditherer.end();
+    interlacedWriter.flush();
+    isImageDecoded = true;
+  }
 
-    capacity = (capacity / 10) * 10; // remove units
-    drawBattery(displayWidth - 16, displayHeight - 16, capacity);
+  // NOTE display controller loads 4bpp pixels in 16 bit words, so the rectangle has to be aligned to 4 pixels
+  bool checkImageRect() const {
+    const bool isAligned = imageX % 4 == 0 && imageWidth % 4 == 0;
+    const bool fits = imageWidth > 0 && imageHeight > 0 && imageX + imageWidth <= displayWidth &&
+                      imageY + imageHeight <= displayHeight;
+    if (!isAligned || !fits) {
+      logE(TAG_APP, "image %dx%d at %d, %d doesn't fit the display", imageWidth, imageHeight, imageX, imageY);
+      return false;
+    }
+    return true;
+  }
 
-    display.showImage(0, 0, displayWidth, displayHeight);
-    display.disconnect();
+  // pixel buffer holds whole image rows only, so every flushed strip is a rectangle
+  uint32_t stripCapacity() const {
+    const uint32_t rowSize = imageWidth / pixelsToByteRatio;
+    return pixelBuffer.size() / rowSize * rowSize;
   }
 
-  void drawBattery(int startX, int startY, int capacity) {
-    std::fill(pixelBuffer.begin(), pixelBuffer.end(), 0xff);
+  bool beginPackedFrame(const PackedFrame::Header& header) {
+    if (viewport.width > 0) {
+      logE(TAG_APP, "packed frame can't be cropped to viewport, group image has to be PNG");
+      return false;
+    }
 
-    constexpr uint16_t iconWidth = 16;
-    constexpr uint16_t iconHeight = 16;
+    imageX = header.x;
+    imageY = header.y;
+    setImageDimension(header.width, header.height);
+    if (!checkImageRect()) return false;
+
+    switch (header.kind) {
+      case PackedFrame::Kind::FULL:
+        break;
+
+      case PackedFrame::Kind::KEYFRAME:
+        // NOTE keyframe's base hash is hash of the keyframe itself
+        expectedBaseHash = header.baseHash;
+        isStoringBaseFrame = !frameStore.matches(header.baseHash, header.width, header.height);
+        if (isStoringBaseFrame) frameStore.beginWrite(header.width * header.height / pixelsToByteRatio);
+        break;
+
+      case PackedFrame::Kind::XOR_DELTA:
+        if (!frameStore.matches(header.baseHash, header.width, header.height)) {
+          logW(TAG_APP, "delta frame base %08x, stored base %08x", header.baseHash, frameStore.hash());
+          needsFullFrame = true;
+          return false;
+        }
+        isDeltaFrame = true;
+        break;
+    }
+
+    return true;
+  }
 
-    constexpr uint16_t batteryHeight = (iconHeight * 90) / 100; // 90% (5% vertical margin)
-    constexpr uint16_t topNotchHeight = (iconHeight * 20) / 100; // 10%
-    constexpr uint16_t batteryThickness = (iconWidth * 50) / 100; // 50%
+  template<typename Writer>
+  void writePackedBytes(std::size_t size, Writer&& write) {
+    const uint32_t imageSize = imageWidth * imageHeight / pixelsToByteRatio;
 
-    for (int y = (iconHeight - batteryHeight) / 2; y <= (iconHeight - batteryHeight) / 2 + topNotchHeight; y++) {
-      for (int x = (iconWidth - (batteryThickness / 2)) / 2;
-           x <= (iconWidth - (batteryThickness / 2)) / 2 + (batteryThickness / 2);
-           x++) {
-        uint32_t pixelIndex = y * iconWidth + x;
-        uint32_t bufferIndex = pixelIndex / pixelsToByteRatio;
+    while (size > 0) {
+      const uint32_t bufferIndex = packedBytesWritten - currentBufferOffset;
+      const std::size_t count = std::min<std::size_t>(size, stripCapacity() - bufferIndex);
 
-        pixelBuffer[bufferIndex] = 0x00;
+      if (isDeltaFrame && bufferIndex == 0) {
+        // delta is applied on top of the stored base frame strip
+        const uint32_t stripSize = std::min<uint32_t>(stripCapacity(), imageSize - currentBufferOffset);
+        frameStore.read(currentBufferOffset, pixelBuffer.data(), stripSize);
       }
-    }
 
-    for (int y = (iconHeight - batteryHeight + topNotchHeight) / 2;
-         y <= (iconHeight - batteryHeight) / 2 + batteryHeight;
-         y++) {
-      for (int x = (iconWidth - batteryThickness) / 2; x <= (iconWidth - batteryThickness) / 2 + batteryThickness;
-           x++) {
-        uint32_t pixelIndex = y * iconWidth + x;
-        uint32_t bufferIndex = pixelIndex / pixelsToByteRatio;
+      write(pixelBuffer.begin() + bufferIndex, count);
+      size -= count;
+      packedBytesWritten += count;
 
-        uint8_t color = 0x0f;
+      const bool isLastByte = packedBytesWritten == imageSize;
+      if (packedBytesWritten - currentBufferOffset == stripCapacity() || isLastByte) {
+        flushPixelBuffer();
+        currentBufferOffset += stripCapacity();
+      }
+      if (isLastByte) {
+        commitBaseFrame();
+        isImageDecoded = true;
+      }
+    }
+  }
 
-        float relativeY = 1.0f - (y - (iconHeight - batteryHeight + topNotchHeight) / 2.0f) / batteryHeight;
+  void commitBaseFrame() {
+    if (!isStoringBaseFrame) return;
 
-        if (relativeY * 100 < capacity) {
-          color = 0x00;
-        }
+    if (frameHash.value != expectedBaseHash) {
+      logE(TAG_APP, "keyframe hash %08x doesn't match its header %08x", frameHash.value, expectedBaseHash);
+      return;
+    }
+    frameStore.commit(frameHash.value, imageWidth, imageHeight);
+  }
 
-        const bool isVerticalBorder = y == (iconHeight - batteryHeight + topNotchHeight) / 2 ||
-          y == (iconHeight - batteryHeight) / 2 + batteryHeight;
-        const bool isHorizontalBorder = ((pixelIndex % 2 == 0) && x == (iconWidth - batteryThickness) / 2) ||
-          ((pixelIndex % 2 == 1) && x == (iconWidth - batteryThickness) / 2 + batteryThickness);
+  void flushPixelBuffer() {
+    logI(TAG_APP, "flushing pixel buffer %d", currentBufferOffset);
 
-        const bool isBorder = isVerticalBorder || isHorizontalBorder;
+    const uint32_t rowSize = imageWidth / pixelsToByteRatio;
+    const uint16_t y = currentBufferOffset / rowSize;
+    const uint16_t height = std::min<uint32_t>(stripCapacity() / rowSize, imageHeight - y);
 
-        if (isBorder) color = 0x00;
+    const uint32_t stripSize = rowSize * height;
+    frameHash.update(pixelBuffer.data(), stripSize);
+    if (isStoringBaseFrame) frameStore.write(currentBufferOffset, pixelBuffer.data(), stripSize);
 
-        if ((pixelIndex % 2) == 0) {
-          pixelBuffer[bufferIndex] = (color & 0x0f) << 4;
-        } else {
-          pixelBuffer[bufferIndex] |= (color & 0x0f);
-        }
-      }
-    }
+    // NOTE overlays are blended after hashing and storing, base frame stays without them
+    writeStrip(y, height);
+  }
 
-    display.sendImage(startX, startY, iconWidth, iconHeight);
+  void drawDisplay() {
+    logW(TAG_APP, "drawing display");
+    isDisplayDrawn = true;
+
+    // NOTE status icons are refreshed only with image covering them
+    uploader.wait();
+    for (const auto& rect : changedRects) {
+#if CONFIG_EINK_PSRAM_FRAMEBUFFER
+      uploadFrameRect(rect);
+      uploader.wait();
+#endif
+      display.showImage(rect.x, rect.y, rect.width, rect.height);
+    }
+    // NOTE full waveform on network wakes clears ghosting left by fast updates
+    if (isClockShown()) drawClock(WaveshareIT8951::Waveform::GLD16);
+    display.disconnect();
   }
 
   void publishStartupDeviceInfo() {
@@ -323,6 +1389,14 @@ struct App {
     mqtt->publish("info/startup/totalHeap", deviceInfo.totalHeap(), es::Mqtt::Qos::Qos0, false);
     // elapsed time before connecting to MQTT
     mqtt->publish("info/startup/time", deviceInfo.uptime(), es::Mqtt::Qos::Qos0, false);
+    const int64_t mqttConnectTime = (esp_timer_get_time() - mqttConnectStartTime) / 1000;
+    mqtt->publish("info/startup/mqttConnectTime", mqttConnectTime, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/startup/tlsResumed", tlsSessionCache.isResumed(), es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/startup/tlsResumptionRate", tlsSessionCache.resumptionRate(), es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/startup/wifiConnectTime", wifiConnectTime / 1000, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/startup/cachedLease", wifiCache.isUsed(), es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/startup/cachedAccessPoint", wifiCache.isAccessPointUsed(), es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/startup/cachedBrokerAddress", brokerAddressCache.isUsed(), es::Mqtt::Qos::Qos0, false);
 
     mqtt->publish("info/startup/batteryRaw", batteryRaw, es::Mqtt::Qos::Qos0, false);
     mqtt->publish("info/startup/batteryVoltage", batteryVoltage, es::Mqtt::Qos::Qos0, false);
@@ -330,6 +1404,8 @@ struct App {
   }
 
   void goToSleep() {
+    // NOTE MQTT task mustn't wait for the ring (holding client lock) while this task publishes
+    chunkRing.close();
     publishAfterDeviceInfo();
     // TODO wait for mqtt publish finish (in publishAfterDeviceInfo) instead of sleep 500ms
     vTaskDelay(pdMS_TO_TICKS(500));
@@ -337,16 +1413,93 @@ struct App {
     if (timedOut) {
       logE(TAG_APP, "Tímed out!");
     }
+    wakeState.failure = timedOut ? WakeState::Failure::TIMEOUT
+      : hasImageError            ? WakeState::Failure::DECODE
+                                 : WakeState::Failure::NONE;
+    wakeState.unchangedWakes = hasNewContent ? 0 : wakeState.unchangedWakes + 1;
+    // NOTE cached address which doesn't reach the broker may be taken by other device meanwhile
+    if (wifiCache.isUsed() && !isMqttConnected) wifiCache.invalidate();
+    if (clockPlacement) {
+      clockState.lastNetworkMinute = LocalClock::shownMinute(std::time(nullptr));
+      clockState.localWakes = 0;
+    }
+
     logW(TAG_APP, "Good night, going to sleep...");
-    esp_sleep_enable_timer_wakeup(std::chrono::microseconds{sleepTime}.count());
+    esp_sleep_enable_timer_wakeup(sleepDuration());
     esp_deep_sleep_start();
   }
 
+  // share of pipeline time (first chunk received .. last strip in display memory) every stage was busy
+  void publishPipelineUtilization() {
+    if (firstChunkTime == 0 || lastChunkTime == 0) return;
+
+    const int64_t pipelineTime = std::max<int64_t>(lastChunkTime - firstChunkTime, 1);
+    const auto percent = [pipelineTime](int64_t time) { return static_cast<uint32_t>(time * 100 / pipelineTime); };
+    const uint32_t handoff = percent(handoffTime);
+    const uint32_t decode = percent(decodeTime - uploader.waitTime());
+    const uint32_t upload = percent(uploader.busyTime());
+    logI(TAG_APP,
+      "pipeline %lld ms, busy: handoff %d %%, decode %d %%, upload %d %%",
+      pipelineTime / 1000,
+      handoff,
+      decode,
+      upload);
+
+    mqtt->publish("info/pipeline/time", pipelineTime / 1000, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/pipeline/handoff", handoff, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/pipeline/decode", decode, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/pipeline/upload", upload, es::Mqtt::Qos::Qos0, false);
+  }
+
+  // high-water marks of this wake, overflows are allocations served by the heap since the arena was full
+  void publishMemoryUsage() {
+    const uint32_t dmaHighWater = dmaArena().highWater();
+    const uint32_t decoderHighWater = decoderArena().highWater();
+    const uint32_t overflows = dmaArena().overflows() + decoderArena().overflows();
+    const uint32_t minFreeInternal = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+    const uint32_t largestFreeDma = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+    logI(TAG_APP,
+      "arenas: DMA %d of %d B, decoder %d of %d B, %d overflows, min free internal %d B, largest DMA block %d B",
+      dmaHighWater,
+      static_cast<int>(dmaArena().size()),
+      decoderHighWater,
+      static_cast<int>(decoderArena().size()),
+      overflows,
+      minFreeInternal,
+      largestFreeDma);
+
+    mqtt->publish("info/memory/dmaArena", dmaHighWater, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/memory/decoderArena", decoderHighWater, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/memory/arenaOverflows", overflows, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/memory/minFreeInternal", minFreeInternal, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/memory/largestFreeDma", largestFreeDma, es::Mqtt::Qos::Qos0, false);
+  }
+
   void publishAfterDeviceInfo() {
     mqtt->publish("info/timedOut", timedOut, es::Mqtt::Qos::Qos0, false);
     mqtt->publish("info/finish/freeHeap", deviceInfo.freeHeap(), es::Mqtt::Qos::Qos0, false);
     mqtt->publish("info/finish/totalHeap", deviceInfo.totalHeap(), es::Mqtt::Qos::Qos0, false);
     mqtt->publish("info/finish/totalTime", deviceInfo.uptime(), es::Mqtt::Qos::Qos0, false);
+
+    // NOTE decode time includes waiting for upload task with previous strip (same for every inflate backend)
+    mqtt->publish(
+      "info/decode/inflate", std::string_view{pngle_get_inflate_backend_name()}, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/decode/time", decodeTime / 1000, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/decode/uploadTime", uploader.busyTime() / 1000, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/decode/framebuffer", hasPsramFrame, es::Mqtt::Qos::Qos0, false);
+
+    publishPipelineUtilization();
+    publishMemoryUsage();
+
+    mqtt->publish("info/frame/hash", frameHash.value, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/frame/baseHash", frameStore.hash(), es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/regions/changed", static_cast<uint32_t>(changedRects.size()), es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/frame/heldStrips", heldStrips, es::Mqtt::Qos::Qos0, false);
+    mqtt->publish("info/frame/skippedDownloads", skippedDownloads, es::Mqtt::Qos::Qos0, false);
+    if (clockPlacement) {
+      mqtt->publish("info/clock/localWakes", clockState.localWakes, es::Mqtt::Qos::Qos0, false);
+      mqtt->publish("info/clock/timeSet", clockState.isTimeSet, es::Mqtt::Qos::Qos0, false);
+    }
   }
 };
 
@@ -0,0 +1,125 @@
+#include "arena.hpp"
+#include "esp_heap_caps.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "essentials/config.hpp"
+#include "essentials/esp32_storage.hpp"
+#include "essentials/wifi.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "power.hpp"
+#include "simple_logger.hpp"
+#include "waveshare_it8951.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace es = essentials;
+
+const char* TAG_APP = "app";
+
+// Sweeps pixel buffer (strip) heights and SPI transfer sizes of display upload and prints a table to serial.
+// WiFi is connected first, so free DMA heap is measured next to WiFi buffers as in the real app.
+// To run it, replace "main.cpp" with "main_benchmark.cpp" in main/CMakeLists.txt.
+struct App {
+  es::Esp32Storage configStorage{"config"};
+  es::Config config{configStorage};
+  es::Config::Value<std::string> ssid = config.get<std::string>("ssid");
+  es::Config::Value<std::string> wifiPass = config.get<std::string>("wifiPass");
+  es::Config::Value<std::string> vComDefault = config.get<std::string>("vcom", "-1.8");
+  es::Config::Value<std::string> adcCalibA = config.get<std::string>("adcA", "49505");
+  es::Config::Value<std::string> adcCalibB = config.get<std::string>("adcB", "269");
+
+  es::Wifi wifi{};
+  Power power{adcCalibA, adcCalibB};
+
+  static constexpr uint16_t displayWidth = 1200;
+  static constexpr uint16_t displayHeight = 825;
+  static constexpr uint32_t rowSize = displayWidth / 2; // 4bpp
+  static constexpr int uploadRepetitions = 3;
+
+  static constexpr uint32_t stripHeights[] = {10, 25, 50, 100};
+  static constexpr int transferSizes[] = {2048, 4096, 8192, 16384, 0}; // 0 = whole strip in one transaction
+
+  void run() {
+    wifi.connect(*ssid, *wifiPass);
+    for (int i = 0; i < 1000 && !wifi.isConnected(); i++) vTaskDelay(pdMS_TO_TICKS(10));
+    logW(TAG_APP, "WiFi %s", wifi.isConnected() ? "connected" : "not connected");
+
+    const float vcom = std::atof((*vComDefault).c_str());
+    holdDmaArena();
+
+    logW(TAG_APP, "| strip rows | buffer B | transfer B | upload ms | free DMA B | largest DMA block B |");
+    for (const uint32_t stripHeight : stripHeights) {
+      if (heap_caps_get_largest_free_block(MALLOC_CAP_DMA) < stripHeight * rowSize) {
+        logE(TAG_APP, "| %10d | not enough DMA capable memory", stripHeight);
+        continue;
+      }
+
+      WaveshareIT8951 display{WaveshareIT8951::Pins{}, power, stripHeight * rowSize};
+      display.powerUp();
+      display.connect(vcom);
+
+      // NOTE measured with pixel buffer allocated and SPI bus initialized
+      const std::size_t freeDma = heap_caps_get_free_size(MALLOC_CAP_DMA);
+      const std::size_t largestDma = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+
+      for (const int transferSize : transferSizes) {
+        const int bufferSize = display.pixelBuffer().size();
+        if (transferSize > bufferSize) continue;
+
+        display.setTransferSize(transferSize);
+        const int64_t uploadTime = measureUpload(display, stripHeight);
+
+        logW(TAG_APP,
+          "| %10d | %8d | %10d | %9.1f | %10d | %19d |",
+          stripHeight,
+          bufferSize,
+          transferSize == 0 ? bufferSize : transferSize,
+          uploadTime / 1000.0f,
+          static_cast<int>(freeDma),
+          static_cast<int>(largestDma));
+      }
+
+      display.disconnect();
+    }
+
+    logW(TAG_APP, "Benchmark finished");
+    while (true) vTaskDelay(pdMS_TO_TICKS(1000));
+  }
+
+  // NOTE pixel buffers which fit would come from the static DMA arena and others from the heap, with the whole arena
+  // held every strip height is allocated from the heap and free DMA columns are comparable
+  void holdDmaArena() {
+    Arena& arena = dmaArena();
+    for (std::size_t size = arena.size(); size > 0; size /= 2) {
+      while (arena.allocate(size) != nullptr) {}
+    }
+    logW(TAG_APP, "DMA arena (%d B) held, pixel buffers are allocated from the heap", static_cast<int>(arena.size()));
+  }
+
+  // average time of whole display upload in strips (no refresh)
+  int64_t measureUpload(WaveshareIT8951& display, uint32_t stripHeight) {
+    auto& pixelBuffer = display.pixelBuffer();
+    std::fill(pixelBuffer.begin(), pixelBuffer.end(), 0xff);
+
+    const int64_t startTime = esp_timer_get_time();
+    for (int i = 0; i < uploadRepetitions; i++) {
+      for (uint32_t y = 0; y < displayHeight; y += stripHeight) {
+        display.sendImage(0, y, displayWidth, std::min<uint32_t>(stripHeight, displayHeight - y));
+      }
+    }
+    return (esp_timer_get_time() - startTime) / uploadRepetitions;
+  }
+};
+
+extern "C" void app_main() {
+  try {
+    App{}.run();
+  } catch (const std::exception& e) {
+    logE(TAG_APP, "EXCEPTION: %s", e.what());
+  } catch (...) {
+    logE(TAG_APP, "UNKNOWN EXCEPTION");
+  }
+  esp_restart();
+}
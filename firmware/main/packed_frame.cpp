@@ -0,0 +1,126 @@
+#include "packed_frame.hpp"
+
+#include <algorithm>
+
+PackedFrameDecoder::PackedFrameDecoder(HeaderCallback onHeader, WriteCallback onWrite, FillCallback onFill) :
+  _onHeader{std::move(onHeader)},
+  _onWrite{std::move(onWrite)},
+  _onFill{std::move(onFill)} {
+}
+
+void PackedFrameDecoder::reset() {
+  _state = State::HEADER;
+  _header = {};
+  _headerBytes = 0;
+  _remainingBytes = 0;
+  _runLength = 0;
+  _error = "No error";
+}
+
+bool PackedFrameDecoder::feed(const uint8_t* data, std::size_t size) {
+  const uint8_t* end = data + size;
+
+  while (data < end) {
+    switch (_state) {
+      case State::HEADER: {
+        const std::size_t count = std::min<std::size_t>(sizeof(PackedFrame::Header) - _headerBytes, end - data);
+        std::copy_n(data, count, reinterpret_cast<uint8_t*>(&_header) + _headerBytes);
+        data += count;
+        _headerBytes += count;
+
+        if (_headerBytes == sizeof(PackedFrame::Header) && !parseHeader()) return false;
+        break;
+      }
+
+      case State::CONTROL: {
+        // PackBits: 0..127 = copy next n + 1 bytes, -1..-127 = repeat next byte 1 - n times, -128 = no-op
+        const auto control = static_cast<int8_t>(*data++);
+        if (control >= 0) {
+          _runLength = control + 1;
+          _state = State::LITERAL;
+        } else if (control != -128) {
+          _runLength = 1 - control;
+          _state = State::REPEAT;
+        }
+        break;
+      }
+
+      case State::LITERAL: {
+        const std::size_t count = std::min<std::size_t>(_runLength, end - data);
+        if (count > _remainingBytes) return fail("Frame data overflow");
+
+        _onWrite(data, count);
+        data += count;
+        _runLength -= count;
+        _remainingBytes -= count;
+
+        if (_header.compression == PackedFrame::Compression::RLE && _runLength == 0) _state = State::CONTROL;
+        break;
+      }
+
+      case State::REPEAT:
+        if (_runLength > _remainingBytes) return fail("Frame data overflow");
+
+        _onFill(*data++, _runLength);
+        _remainingBytes -= _runLength;
+        _state = State::CONTROL;
+        break;
+
+      case State::DONE:
+        return fail("Trailing data after frame");
+
+      case State::ERROR:
+        return false;
+    }
+
+    const bool isDecodingPixels = _state == State::CONTROL || _state == State::LITERAL || _state == State::REPEAT;
+    if (isDecodingPixels && _remainingBytes == 0) _state = State::DONE;
+  }
+
+  return true;
+}
+
+bool PackedFrameDecoder::parseHeader() {
+  if (_header.magic != PackedFrame::magic) return fail("Incorrect packed frame signature");
+  if (_header.version != PackedFrame::version) return fail("Unsupported packed frame version");
+  if (_header.bpp != 4) return fail("Unsupported bits per pixel");
+  if (_header.width % 2 != 0) return fail("Frame width must be even");
+  if (_header.kind > PackedFrame::Kind::XOR_DELTA) return fail("Unsupported frame kind");
+
+  _remainingBytes = static_cast<std::size_t>(_header.width) * _header.height / 2;
+
+  switch (_header.compression) {
+    case PackedFrame::Compression::NONE:
+      _state = State::LITERAL;
+      _runLength = _remainingBytes;
+      break;
+    case PackedFrame::Compression::RLE:
+      _state = State::CONTROL;
+      break;
+    default:
+      return fail("Unsupported compression");
+  }
+
+  if (!_onHeader(_header)) return fail("Frame rejected");
+  if (_remainingBytes == 0) _state = State::DONE;
+
+  return true;
+}
+
+bool PackedFrameDecoder::fail(const char* error) {
+  _error = error;
+  _state = State::ERROR;
+  return false;
+}
+
+bool PackedFrameDecoder::isDone() const {
+  return _state == State::DONE;
+}
+
+const char* PackedFrameDecoder::error() const {
+  return _error;
+}
+
+const PackedFrame::Header& PackedFrameDecoder::header() const {
+  return _header;
+}
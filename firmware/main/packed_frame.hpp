@@ -0,0 +1,85 @@
+// Native e-ink frame format ("packed frame")
+//
+// 20 byte little-endian header followed by 4bpp packed pixels (2 pixels per byte, left pixel in high nibble, rows
+// without padding) compressed by PackBits RLE or stored as is. Encoder lives in tools/encodeFrame.js.
+//
+// Keyframe is stored in flash as a base for following XOR delta frames. Its baseHash is FNV-1a hash of its own
+// packed pixels. Delta frame pixels are XOR-ed with the base frame of baseHash.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+struct PackedFrame {
+  static constexpr std::array<uint8_t, 4> magic{'E', 'P', 'F', 'R'};
+  static constexpr uint8_t version = 1;
+
+  enum class Compression : uint8_t {
+    NONE = 0,
+    RLE = 1, // PackBits
+  };
+
+  enum class Kind : uint8_t {
+    FULL = 0,
+    KEYFRAME = 1,
+    XOR_DELTA = 2,
+  };
+
+  struct Header {
+    std::array<uint8_t, 4> magic;
+    uint8_t version;
+    uint8_t bpp;
+    Compression compression;
+    Kind kind;
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint32_t baseHash;
+  } __attribute__((packed));
+
+  static_assert(sizeof(Header) == 20, "Packed frame header must be 20 bytes");
+
+  static bool isPackedFrame(const uint8_t* data, std::size_t size) {
+    return size >= magic.size() && std::memcmp(data, magic.data(), magic.size()) == 0;
+  }
+};
+
+struct PackedFrameDecoder {
+  // return false to reject the frame
+  using HeaderCallback = std::function<bool(const PackedFrame::Header& header)>;
+  using WriteCallback = std::function<void(const uint8_t* data, std::size_t size)>;
+  using FillCallback = std::function<void(uint8_t value, std::size_t count)>;
+
+private:
+  enum class State { HEADER, CONTROL, LITERAL, REPEAT, DONE, ERROR };
+
+  HeaderCallback _onHeader;
+  WriteCallback _onWrite;
+  FillCallback _onFill;
+
+  State _state{State::HEADER};
+  PackedFrame::Header _header{};
+  std::size_t _headerBytes{};
+  std::size_t _remainingBytes{}; // of packed pixels
+  std::size_t _runLength{};
+  const char* _error{"No error"};
+
+public:
+  PackedFrameDecoder(HeaderCallback onHeader, WriteCallback onWrite, FillCallback onFill);
+
+  // returns false on malformed frame (see error())
+  bool feed(const uint8_t* data, std::size_t size);
+  void reset();
+
+  bool isDone() const;
+  const char* error() const;
+  const PackedFrame::Header& header() const;
+
+private:
+  bool parseHeader();
+  bool fail(const char* error);
+};
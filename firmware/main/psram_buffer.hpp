@@ -0,0 +1,35 @@
+#pragma once
+
+#include "esp_heap_caps.h"
+
+#include <vector>
+
+template<class T>
+struct PsramAllocator {
+  using value_type = T;
+  PsramAllocator() noexcept = default;
+
+  template<class U>
+  PsramAllocator(const PsramAllocator<U>&) noexcept {};
+
+  T* allocate(std::size_t n) {
+    return reinterpret_cast<T*>(heap_caps_malloc(n * sizeof(T), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+  }
+
+  void deallocate(T* p, std::size_t n) {
+    heap_caps_free(p);
+  }
+};
+
+template<class T, class U>
+constexpr bool operator==(const PsramAllocator<T>&, const PsramAllocator<U>&) noexcept {
+  return false;
+}
+
+template<class T, class U>
+constexpr bool operator!=(const PsramAllocator<T>&, const PsramAllocator<U>&) noexcept {
+  return true;
+}
+
+// NOTE PSRAM can't be DMA source, content goes to display through internal (DMA capable) pixel buffer
+using PsramBuffer = std::vector<uint8_t, PsramAllocator<uint8_t>>;
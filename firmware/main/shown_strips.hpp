@@ -0,0 +1,97 @@
+#pragma once
+
+#include "frame_hash.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+// Holds back display upload of image strips which are the same as the panel already shows.
+//
+// Hash of every strip (its rectangle and packed pixels with overlays blended) of the last shown image is kept in RTC
+// memory. Strips are held while they match it, since the first different strip all strips are uploaded, so display
+// memory is valid from there on. Only rows from the first to the last changed strip have to be refreshed, when every
+// strip matches the refresh is skipped at all.
+class ShownStrips {
+public:
+  // 17 strips of full screen image with default pixel buffer, images with more strips are never the same
+  static constexpr std::size_t maxStrips = 24;
+
+  // hashes of the last shown image, 0 strips when unknown
+  struct State {
+    uint32_t stripCount;
+    uint32_t stripHashes[maxStrips];
+  };
+
+private:
+  State _shown{};
+  State _current{};
+  bool _isEnabled{};
+  bool _hasChanged{};
+  uint32_t _strips{};
+  uint32_t _changedTop{};
+  uint32_t _changedBottom{};
+
+public:
+  void begin(const State& shown) {
+    _shown = shown;
+    _current = {};
+    _isEnabled = true;
+    _hasChanged = false;
+    _strips = 0;
+    _changedTop = 0;
+    _changedBottom = 0;
+  }
+
+  // all strips are uploaded (and nothing is known about the image)
+  void disable() {
+    _isEnabled = false;
+    _current = {};
+  }
+
+  // returns true when the strip at x, y (packed 4bpp) has to be uploaded to display memory
+  bool submit(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t* strip) {
+    if (!_isEnabled) return true;
+
+    FrameHash hash{};
+    const uint16_t rect[] = {x, y, width, height};
+    hash.update(reinterpret_cast<const uint8_t*>(rect), sizeof(rect));
+    hash.update(strip, width / 2 * height);
+
+    const uint32_t index = _strips++;
+    if (index < maxStrips) {
+      _current.stripHashes[index] = hash.value;
+      _current.stripCount = index + 1;
+    }
+
+    const bool isSame = index < _shown.stripCount && index < maxStrips && _shown.stripHashes[index] == hash.value;
+    if (isSame) return _hasChanged;
+
+    if (!_hasChanged) _changedTop = y;
+    _hasChanged = true;
+    _changedBottom = y + height;
+    return true;
+  }
+
+  bool isEnabled() const {
+    return _isEnabled;
+  }
+
+  // every strip is the same as shown (NOTE image with strips of the shown one cut off is the same as well)
+  bool isUnchanged() const {
+    return _isEnabled && !_hasChanged;
+  }
+
+  // rows to refresh, valid when enabled and not unchanged
+  uint32_t changedTop() const {
+    return _changedTop;
+  }
+
+  uint32_t changedBottom() const {
+    return _changedBottom;
+  }
+
+  // to be kept once the image is shown
+  const State& state() const {
+    return _current;
+  }
+};
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+
+// Status and weather icons as 4bpp pixels (packed as display strips, left pixel in high nibble) with 1 bit opacity
+// mask. All sprites are generated at compile time, blending them into a strip is just nibble copying.
+struct Sprite {
+  uint16_t width;
+  uint16_t height;
+  const uint8_t* pixels;
+  const uint8_t* mask; // bit per pixel, MSB first
+
+  constexpr bool isOpaque(uint16_t x, uint16_t y) const {
+    const uint32_t i = y * width + x;
+    return (mask[i / 8] >> (7 - i % 8)) & 1;
+  }
+
+  constexpr uint8_t level(uint16_t x, uint16_t y) const {
+    const uint32_t i = y * width + x;
+    return (i % 2) == 0 ? pixels[i / 2] >> 4 : pixels[i / 2] & 0x0f;
+  }
+};
+
+template<uint16_t Width, uint16_t Height>
+struct SpriteData {
+  static_assert((Width * Height) % 2 == 0, "Sprite must fill whole bytes");
+
+  std::array<uint8_t, Width * Height / 2> pixels{};
+  std::array<uint8_t, (Width * Height + 7) / 8> mask{};
+
+  constexpr void set(int x, int y, uint8_t level) {
+    if (x < 0 || y < 0 || x >= Width || y >= Height) return;
+
+    const uint32_t i = y * Width + x;
+    uint8_t& byte = pixels[i / 2];
+    byte = (i % 2) == 0 ? (byte & 0x0f) | (level << 4) : (byte & 0xf0) | level;
+    mask[i / 8] |= 0x80 >> (i % 8);
+  }
+
+  constexpr void fill(int x, int y, int width, int height, uint8_t level) {
+    for (int j = y; j < y + height; j++) {
+      for (int i = x; i < x + width; i++) set(i, j, level);
+    }
+  }
+
+  constexpr bool isOpaque(int x, int y) const {
+    if (x < 0 || y < 0 || x >= Width || y >= Height) return false;
+    return view().isOpaque(x, y);
+  }
+
+  // white 1 pixel outline keeps the icon readable on dark images
+  constexpr void addHalo() {
+    SpriteData original = *this;
+    for (int y = 0; y < Height; y++) {
+      for (int x = 0; x < Width; x++) {
+        if (original.isOpaque(x, y)) continue;
+
+        bool isNeighbour = false;
+        for (int dy = -1; dy <= 1; dy++) {
+          for (int dx = -1; dx <= 1; dx++) isNeighbour = isNeighbour || original.isOpaque(x + dx, y + dy);
+        }
+        if (isNeighbour) set(x, y, white);
+      }
+    }
+  }
+
+  constexpr Sprite view() const {
+    return Sprite{Width, Height, pixels.data(), mask.data()};
+  }
+
+  static constexpr uint16_t width = Width;
+  static constexpr uint16_t height = Height;
+  static constexpr uint8_t black = 0x0;
+  static constexpr uint8_t gray = 0xb;
+  static constexpr uint8_t white = 0xf;
+};
+
+namespace sprites {
+using Icon = SpriteData<16, 16>;
+
+// capacity in tenths (0 - 10)
+constexpr Icon makeBattery(int tenths) {
+  Icon icon{};
+  icon.fill(6, 1, 4, 2, Icon::black); // notch
+  icon.fill(4, 3, 8, 12, Icon::black); // body border
+  icon.fill(5, 4, 6, 10, Icon::white);
+  icon.fill(5, 4 + 10 - tenths, 6, tenths, Icon::black); // charge fills 10 inner rows from bottom
+  icon.addHalo();
+  return icon;
+}
+
+// signal level 0 - 4 (dark bars)
+constexpr Icon makeWifi(int level) {
+  Icon icon{};
+  for (int bar = 0; bar < 4; bar++) {
+    const int height = 4 + bar * 3;
+    icon.fill(1 + bar * 4, 15 - height, 3, height, bar < level ? Icon::black : Icon::gray);
+  }
+  icon.addHalo();
+  return icon;
+}
+
+constexpr bool isInCircle(int x, int y, int minDistance2, int maxDistance2) {
+  // in half pixels from the icon center (7.5, 7.5)
+  const int distance2 = (2 * x - 15) * (2 * x - 15) + (2 * y - 15) * (2 * y - 15);
+  return distance2 >= minDistance2 && distance2 <= maxDistance2;
+}
+
+// clock face, data on the display are old
+constexpr Icon makeStale() {
+  Icon icon{};
+  for (int y = 0; y < 16; y++) {
+    for (int x = 0; x < 16; x++) {
+      if (isInCircle(x, y, 0, 196)) icon.set(x, y, isInCircle(x, y, 0, 120) ? Icon::white : Icon::black);
+    }
+  }
+  icon.fill(7, 3, 2, 6, Icon::black); // minute hand
+  icon.fill(7, 7, 5, 2, Icon::black); // hour hand
+  icon.addHalo();
+  return icon;
+}
+
+// exclamation mark in a disc, last update failed
+constexpr Icon makeError() {
+  Icon icon{};
+  for (int y = 0; y < 16; y++) {
+    for (int x = 0; x < 16; x++) {
+      if (isInCircle(x, y, 0, 196)) icon.set(x, y, Icon::black);
+    }
+  }
+  icon.fill(7, 3, 2, 7, Icon::white);
+  icon.fill(7, 11, 2, 2, Icon::white);
+  icon.addHalo();
+  return icon;
+}
+
+// weather icons of layouts (see layout.hpp)
+using WeatherIcon = SpriteData<32, 32>;
+
+// pixel x, y is in disc (center and radius in pixels, pixel centers are compared in half pixels)
+constexpr bool isInDisc(int x, int y, int centerX, int centerY, int radius) {
+  const int dx = 2 * x + 1 - 2 * centerX;
+  const int dy = 2 * y + 1 - 2 * centerY;
+  return dx * dx + dy * dy <= 4 * radius * radius;
+}
+
+// cloud with flat bottom, shifted by dy rows (negative leaves space for precipitation below)
+constexpr bool isInCloud(int x, int y, int dy) {
+  y -= dy;
+  return isInDisc(x, y, 11, 18, 6) || isInDisc(x, y, 18, 13, 8) || isInDisc(x, y, 25, 18, 5) ||
+         (x >= 11 && x <= 25 && y >= 18 && y <= 23);
+}
+
+// white cloud with 2 pixel black outline
+constexpr void drawCloud(WeatherIcon& icon, int dy) {
+  for (int y = 0; y < WeatherIcon::height; y++) {
+    for (int x = 0; x < WeatherIcon::width; x++) {
+      if (!isInCloud(x, y, dy)) continue;
+
+      bool isOutline = false;
+      for (const auto& [ox, oy] : {std::pair{-2, 0}, {2, 0}, {0, -2}, {0, 2}, {-1, -1}, {1, -1}, {-1, 1}, {1, 1}}) {
+        isOutline = isOutline || !isInCloud(x + ox, y + oy, dy);
+      }
+      icon.set(x, y, isOutline ? WeatherIcon::black : WeatherIcon::white);
+    }
+  }
+}
+
+constexpr WeatherIcon makeSun() {
+  WeatherIcon icon{};
+  for (int y = 0; y < WeatherIcon::height; y++) {
+    for (int x = 0; x < WeatherIcon::width; x++) {
+      if (isInDisc(x, y, 16, 16, 7)) icon.set(x, y, WeatherIcon::black);
+    }
+  }
+  icon.fill(15, 1, 2, 5, WeatherIcon::black);
+  icon.fill(15, 26, 2, 5, WeatherIcon::black);
+  icon.fill(1, 15, 5, 2, WeatherIcon::black);
+  icon.fill(26, 15, 5, 2, WeatherIcon::black);
+  for (int i = 0; i < 4; i++) {
+    icon.fill(5 + i, 5 + i, 2, 1, WeatherIcon::black);
+    icon.fill(25 - i, 5 + i, 2, 1, WeatherIcon::black);
+    icon.fill(5 + i, 26 - i, 2, 1, WeatherIcon::black);
+    icon.fill(25 - i, 26 - i, 2, 1, WeatherIcon::black);
+  }
+  icon.addHalo();
+  return icon;
+}
+
+constexpr WeatherIcon makeCloud() {
+  WeatherIcon icon{};
+  drawCloud(icon, 0);
+  icon.addHalo();
+  return icon;
+}
+
+constexpr WeatherIcon makeRain() {
+  WeatherIcon icon{};
+  drawCloud(icon, -5);
+  for (const int x : {11, 17, 23}) {
+    for (int t = 0; t < 8; t++) icon.fill(x - t / 3, 22 + t, 2, 1, WeatherIcon::black);
+  }
+  icon.addHalo();
+  return icon;
+}
+
+constexpr WeatherIcon makeSnow() {
+  WeatherIcon icon{};
+  drawCloud(icon, -5);
+  for (const auto& [x, y] : {std::pair{10, 25}, {17, 28}, {24, 24}}) {
+    icon.fill(x - 2, y, 5, 1, WeatherIcon::black);
+    icon.fill(x, y - 2, 1, 5, WeatherIcon::black);
+    icon.fill(x - 1, y - 1, 3, 3, WeatherIcon::black);
+  }
+  icon.addHalo();
+  return icon;
+}
+
+constexpr WeatherIcon makeStorm() {
+  WeatherIcon icon{};
+  drawCloud(icon, -5);
+  // lightning bolt
+  for (int t = 0; t < 5; t++) icon.fill(18 - t, 19 + t, 3, 1, WeatherIcon::black);
+  icon.fill(13, 24, 8, 2, WeatherIcon::black);
+  for (int t = 0; t < 6; t++) icon.fill(18 - t, 26 + t, 3, 1, WeatherIcon::black);
+  icon.addHalo();
+  return icon;
+}
+
+inline constexpr WeatherIcon sun{makeSun()};
+inline constexpr WeatherIcon cloud{makeCloud()};
+inline constexpr WeatherIcon rain{makeRain()};
+inline constexpr WeatherIcon snow{makeSnow()};
+inline constexpr WeatherIcon storm{makeStorm()};
+
+inline constexpr std::array<Icon, 11> battery{makeBattery(0),
+  makeBattery(1),
+  makeBattery(2),
+  makeBattery(3),
+  makeBattery(4),
+  makeBattery(5),
+  makeBattery(6),
+  makeBattery(7),
+  makeBattery(8),
+  makeBattery(9),
+  makeBattery(10)};
+inline constexpr std::array<Icon, 5> wifi{makeWifi(0), makeWifi(1), makeWifi(2), makeWifi(3), makeWifi(4)};
+inline constexpr Icon stale{makeStale()};
+inline constexpr Icon error{makeError()};
+} // namespace sprites
+
+struct Overlay {
+  uint16_t x;
+  uint16_t y;
+  Sprite sprite;
+};
+
+// blends opaque sprite pixels into strip of packed 4bpp rows placed at x, y on the display
+template<typename Overlays>
+void blendOverlays(const Overlays& overlays, uint8_t* strip, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+  const uint32_t rowSize = width / 2;
+  for (const Overlay& overlay : overlays) {
+    const uint32_t top = std::max<uint32_t>(y, overlay.y);
+    const uint32_t bottom = std::min<uint32_t>(y + height, overlay.y + overlay.sprite.height);
+    const uint32_t left = std::max<uint32_t>(x, overlay.x);
+    const uint32_t right = std::min<uint32_t>(x + width, overlay.x + overlay.sprite.width);
+
+    for (uint32_t row = top; row < bottom; row++) {
+      for (uint32_t column = left; column < right; column++) {
+        const uint16_t spriteX = column - overlay.x;
+        const uint16_t spriteY = row - overlay.y;
+        if (!overlay.sprite.isOpaque(spriteX, spriteY)) continue;
+
+        const uint32_t i = column - x;
+        const uint8_t level = overlay.sprite.level(spriteX, spriteY);
+        uint8_t& byte = strip[(row - y) * rowSize + i / 2];
+        byte = (i % 2) == 0 ? (byte & 0x0f) | (level << 4) : (byte & 0xf0) | level;
+      }
+    }
+  }
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+// Packs gray levels of row-major pixels (non-interlaced PNG) into strips of whole image rows.
+//
+// Pixels are collected in a byte with advancing bit shift, whole bytes are stored through write pointer and rows are
+// counted down, so the innermost loop has no multiplication, division or modulo (and no buffer reads).
+// Pixels are packed MSB first (left pixel in high nibble for 4bpp), every row starts on whole byte.
+template<uint8_t Bpp>
+class StripPacker {
+  static_assert(Bpp == 1 || Bpp == 2 || Bpp == 4 || Bpp == 8, "Pixels must fill whole bytes");
+
+  static constexpr uint8_t firstShift = 8 - Bpp;
+
+public:
+  // strip of rows starting at image row y is in buffer
+  using FlushCallback = std::function<void(uint32_t y, uint32_t rows)>;
+
+private:
+  uint8_t* _buffer;
+  std::size_t _bufferSize;
+  FlushCallback _onFlush;
+
+  uint8_t* _it{};
+  uint8_t _byte{};
+  uint8_t _shift{firstShift};
+  uint32_t _width{};
+  uint32_t _columnsLeft{};
+  uint32_t _rowsLeft{};
+  uint32_t _stripRows{};
+  uint32_t _stripRow{};
+  uint32_t _stripY{};
+
+public:
+  StripPacker(uint8_t* buffer, std::size_t bufferSize, FlushCallback onFlush) :
+    _buffer{buffer},
+    _bufferSize{bufferSize},
+    _onFlush{std::move(onFlush)} {
+  }
+
+  static constexpr uint32_t rowSize(uint32_t width) {
+    return (width * Bpp + 7) / 8;
+  }
+
+  void begin(uint32_t width, uint32_t height) {
+    _it = _buffer;
+    _byte = 0;
+    _shift = firstShift;
+    _width = width;
+    _columnsLeft = width;
+    _rowsLeft = height;
+    _stripRows = std::min<uint32_t>(_bufferSize / rowSize(width), height);
+    _stripRow = 0;
+    _stripY = 0;
+  }
+
+  // level: 0 .. 2^Bpp - 1, returns true after the last pixel of the image (all strips are flushed)
+  bool push(uint8_t level) {
+    _byte |= level << _shift;
+    if (_shift == 0) {
+      storeByte();
+    } else {
+      _shift -= Bpp;
+    }
+
+    if (--_columnsLeft == 0) return endRow();
+    return false;
+  }
+
+  uint32_t stripRows() const {
+    return _stripRows;
+  }
+
+private:
+  void storeByte() {
+    *_it++ = _byte;
+    _byte = 0;
+    _shift = firstShift;
+  }
+
+  bool endRow() {
+    // last byte of odd width row is padded
+    if (_shift != firstShift) storeByte();
+
+    _columnsLeft = _width;
+    _stripRow++;
+    _rowsLeft--;
+
+    if (_stripRow == _stripRows || _rowsLeft == 0) {
+      _onFlush(_stripY, _stripRow);
+      _stripY += _stripRow;
+      _stripRow = 0;
+      _it = _buffer;
+    }
+    return _rowsLeft == 0;
+  }
+};
@@ -0,0 +1,62 @@
+#include "strip_uploader.hpp"
+
+#include "esp_timer.h"
+#include "exception.hpp"
+
+#include <cstring>
+
+StripUploader::StripUploader(WaveshareIT8951& display, UBaseType_t priority, BaseType_t core) :
+  _display{display},
+  _strips{xQueueCreate(1, sizeof(Strip))},
+  _idle{xSemaphoreCreateBinary()} {
+  if (_strips == nullptr || _idle == nullptr) throw Exception("Couldn't create strip uploader queue");
+  xSemaphoreGive(_idle);
+
+  const auto created = xTaskCreatePinnedToCore(
+    [](void* uploader) { static_cast<StripUploader*>(uploader)->run(); },
+    "uploadTask",
+    4096,
+    this,
+    priority,
+    nullptr,
+    core);
+  if (created != pdPASS) throw Exception("Couldn't create upload task");
+}
+
+void StripUploader::submit(const uint8_t* strip, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+  const int64_t waitStartTime = esp_timer_get_time();
+  xSemaphoreTake(_idle, portMAX_DELAY);
+  _waitTime += esp_timer_get_time() - waitStartTime;
+
+  std::memcpy(_display.pixelBuffer().data(), strip, width * height / 2);
+  const Strip next{x, y, width, height};
+  xQueueSend(_strips, &next, portMAX_DELAY);
+}
+
+void StripUploader::wait() {
+  const int64_t waitStartTime = esp_timer_get_time();
+  xSemaphoreTake(_idle, portMAX_DELAY);
+  xSemaphoreGive(_idle);
+  _waitTime += esp_timer_get_time() - waitStartTime;
+}
+
+int64_t StripUploader::busyTime() const {
+  return _busyTime;
+}
+
+int64_t StripUploader::waitTime() const {
+  return _waitTime;
+}
+
+void StripUploader::run() {
+  while (true) {
+    Strip strip{};
+    xQueueReceive(_strips, &strip, portMAX_DELAY);
+
+    const int64_t startTime = esp_timer_get_time();
+    _display.sendImage(strip.x, strip.y, strip.width, strip.height);
+    _busyTime += esp_timer_get_time() - startTime;
+
+    xSemaphoreGive(_idle);
+  }
+}
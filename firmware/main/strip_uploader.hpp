@@ -0,0 +1,48 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "waveshare_it8951.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+// Sends strips to display memory from own high priority task. Submitted strip is copied into display pixel buffer
+// (DMA capable), so the decoder fills its buffer with the next strip while the previous one is on the SPI bus.
+struct StripUploader {
+private:
+  struct Strip {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+  };
+
+  WaveshareIT8951& _display;
+  QueueHandle_t _strips{};
+  SemaphoreHandle_t _idle{};
+  std::atomic<int64_t> _busyTime{};
+  int64_t _waitTime{};
+
+public:
+  // NOTE upload task is never stopped, the app ends by deep sleep or restart
+  StripUploader(WaveshareIT8951& display, UBaseType_t priority, BaseType_t core);
+
+  StripUploader(const StripUploader&) = delete;
+  StripUploader& operator=(const StripUploader&) = delete;
+
+  // returns as soon as the strip is copied, x and width multiple of 4
+  void submit(const uint8_t* strip, uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  // blocks until submitted strips are in display memory, needed before any other use of the display
+  void wait();
+
+  // time spent sending strips to display
+  int64_t busyTime() const;
+  // time submit() and wait() blocked the caller
+  int64_t waitTime() const;
+
+private:
+  void run();
+};
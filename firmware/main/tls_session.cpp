@@ -0,0 +1,138 @@
+#include "tls_session.hpp"
+
+#include "frame_hash.hpp"
+#include "mbedtls/platform.h"
+#include "mbedtls/ssl.h"
+#include "simple_logger.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+const char* TAG_TLS_SESSION = "tlsSession";
+
+namespace {
+TlsSessionCache* activeCache{};
+
+uint32_t hashServer(std::string_view host, int port) {
+  FrameHash hash{};
+  hash.update(reinterpret_cast<const uint8_t*>(host.data()), host.size());
+  hash.update(reinterpret_cast<const uint8_t*>(&port), sizeof(port));
+  return hash.value;
+}
+} // namespace
+
+extern "C" {
+int __real_esp_tls_conn_new_sync(const char* hostname, int hostlen, int port, const esp_tls_cfg_t* cfg, esp_tls_t* tls);
+
+// NOTE linked instead of esp_tls_conn_new_sync() (-Wl,--wrap), which calls __real_esp_tls_conn_new_sync()
+int __wrap_esp_tls_conn_new_sync(
+  const char* hostname, int hostlen, int port, const esp_tls_cfg_t* cfg, esp_tls_t* tls) {
+  if (activeCache == nullptr || cfg == nullptr) return __real_esp_tls_conn_new_sync(hostname, hostlen, port, cfg, tls);
+  return activeCache->connect(hostname, hostlen, port, *cfg, tls);
+}
+}
+
+TlsSessionCache::TlsSessionCache(State& state, BrokerAddressCache& addressCache) :
+  _state{state}, _addressCache{addressCache} {}
+
+void TlsSessionCache::begin(std::string_view url) {
+  // scheme://host[:port][/path]
+  const std::size_t schemeEnd = url.find("://");
+  const std::size_t hostStart = schemeEnd == std::string_view::npos ? 0 : schemeEnd + 3;
+  const std::size_t hostEnd = url.find_first_of(":/", hostStart);
+  _host = url.substr(hostStart, hostEnd == std::string_view::npos ? std::string_view::npos : hostEnd - hostStart);
+  activeCache = this;
+}
+
+int TlsSessionCache::connect(const char* host, int hostLength, int port, const esp_tls_cfg_t& config, esp_tls_t* tls) {
+  const std::string_view hostName{host, static_cast<std::size_t>(hostLength)};
+  if (hostName != _host) return __real_esp_tls_conn_new_sync(host, hostLength, port, &config, tls);
+
+  const uint32_t serverHash = hashServer(hostName, port);
+  if (_state.serverHash != serverHash) {
+    // other broker in settings
+    _state = {serverHash, 0, {}, _state.offeredHandshakes, _state.resumedHandshakes};
+  }
+
+  esp_tls_client_session_t* offered = load();
+  esp_tls_cfg_t resumingConfig = config;
+  resumingConfig.client_session = offered;
+
+  const int result = _addressCache.connect(host, hostLength, port, resumingConfig, tls);
+  _isResumed = false;
+  if (result == 1) {
+    esp_tls_client_session_t* session = esp_tls_get_client_session(tls);
+    if (offered != nullptr) {
+      _state.offeredHandshakes++;
+      // NOTE full handshake derives new master secret, resumed session keeps it
+      const auto& master = offered->saved_session.master;
+      _isResumed = session != nullptr && std::memcmp(session->saved_session.master, master, sizeof(master)) == 0;
+      if (_isResumed) _state.resumedHandshakes++;
+      logI(TAG_TLS_SESSION, "cached session %s", _isResumed ? "resumed" : "rejected, full handshake");
+    }
+    store(session);
+  } else if (offered != nullptr) {
+    logW(TAG_TLS_SESSION, "handshake with cached session failed, dropping it");
+    invalidate();
+  }
+
+  if (offered != nullptr) esp_tls_free_client_session(offered);
+  return result;
+}
+
+void TlsSessionCache::invalidate() {
+  _state.sessionSize = 0;
+}
+
+bool TlsSessionCache::isResumed() const {
+  return _isResumed;
+}
+
+uint32_t TlsSessionCache::resumptionRate() const {
+  if (_state.offeredHandshakes == 0) return 0;
+  return static_cast<uint64_t>(_state.resumedHandshakes) * 100 / _state.offeredHandshakes;
+}
+
+esp_tls_client_session_t* TlsSessionCache::load() {
+  if (_state.sessionSize == 0 || _state.sessionSize > maxSessionSize) return nullptr;
+
+  auto session = static_cast<esp_tls_client_session_t*>(std::calloc(1, sizeof(esp_tls_client_session_t)));
+  if (session == nullptr) return nullptr;
+  mbedtls_ssl_session_init(&session->saved_session);
+
+  const int result = mbedtls_ssl_session_load(&session->saved_session, _state.session, _state.sessionSize);
+  if (result != 0) {
+    // eg. mbedTLS of other version or configuration after firmware update
+    logW(TAG_TLS_SESSION, "cached session can't be loaded: -0x%04x", -result);
+    esp_tls_free_client_session(session);
+    invalidate();
+    return nullptr;
+  }
+  return session;
+}
+
+void TlsSessionCache::store(esp_tls_client_session_t* session) {
+  invalidate();
+  if (session == nullptr) return;
+
+#if defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE)
+  // NOTE resumed session isn't verified again, its certificate would take most of RTC memory
+  mbedtls_ssl_session& saved = session->saved_session;
+  if (saved.peer_cert != nullptr) {
+    mbedtls_x509_crt_free(saved.peer_cert);
+    mbedtls_free(saved.peer_cert);
+    saved.peer_cert = nullptr;
+  }
+#endif
+
+  std::size_t size = 0;
+  const int result = mbedtls_ssl_session_save(&session->saved_session, _state.session, maxSessionSize, &size);
+  esp_tls_free_client_session(session);
+  if (result != 0) {
+    logW(TAG_TLS_SESSION, "session can't be cached: -0x%04x (%zu B)", -result, size);
+    return;
+  }
+
+  _state.sessionSize = size;
+  logI(TAG_TLS_SESSION, "cached session (%zu B)", size);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "broker_address.hpp"
+#include "esp_tls.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// TLS session of MQTT broker kept in RTC memory.
+//
+// Handshake of the next wake offers the session (session ticket or session ID) and the broker which still knows it
+// resumes it by abbreviated handshake, without certificate verification and key exchange. Otherwise the broker makes
+// a full handshake in the same connection, handshake which fails with offered session drops it, so the reconnect is a
+// full one.
+//
+// esp-mqtt doesn't expose esp-tls session of its transport, esp_tls_conn_new_sync() of tcp_transport is wrapped by
+// linker (see CMakeLists.txt) and goes through connect(), which connects through BrokerAddressCache.
+class TlsSessionCache {
+public:
+  // serialized mbedTLS session without peer certificate (it was verified by the full handshake) and ticket
+  static constexpr std::size_t maxSessionSize = 512;
+
+  // survives deep sleep, zero after power on
+  struct State {
+    uint32_t serverHash; // host and port of the session
+    uint32_t sessionSize; // 0 = none
+    uint8_t session[maxSessionSize];
+    uint32_t offeredHandshakes; // since power on
+    uint32_t resumedHandshakes;
+  };
+
+private:
+  State& _state;
+  BrokerAddressCache& _addressCache;
+  std::string _host{};
+  bool _isResumed{};
+
+public:
+  TlsSessionCache(State& state, BrokerAddressCache& addressCache);
+
+  // sessions of connections to host of url are kept, before MQTT client starts
+  void begin(std::string_view url);
+  // esp_tls_conn_new_sync() with cached session offered
+  int connect(const char* host, int hostLength, int port, const esp_tls_cfg_t& config, esp_tls_t* tls);
+  void invalidate();
+
+  // the last handshake resumed cached session
+  bool isResumed() const;
+  // percent of handshakes which offered cached session and resumed it, since power on
+  uint32_t resumptionRate() const;
+
+private:
+  esp_tls_client_session_t* load();
+  void store(esp_tls_client_session_t* session);
+};
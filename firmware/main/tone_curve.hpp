@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+// 256 entry gray -> gray lookup table applied to decoded pixels before they are reduced to 16 gray levels.
+// Built once per wake, either from gamma with black/white points or from explicit 16 point curve.
+struct ToneCurve {
+  using Table = std::array<uint8_t, 256>;
+
+  static constexpr std::size_t curvePoints = 16;
+
+  static Table identity() {
+    Table table{};
+    for (std::size_t i = 0; i < table.size(); i++) table[i] = i;
+    return table;
+  }
+
+  // input below black point is black, above white point is white, gamma > 1 brightens midtones
+  static Table fromGamma(float gamma, uint8_t blackPoint, uint8_t whitePoint) {
+    if (gamma <= 0.0f || blackPoint >= whitePoint) return identity();
+
+    Table table{};
+    for (std::size_t i = 0; i < table.size(); i++) {
+      const float t = std::clamp((static_cast<float>(i) - blackPoint) / (whitePoint - blackPoint), 0.0f, 1.0f);
+      table[i] = static_cast<uint8_t>(std::lround(std::pow(t, 1.0f / gamma) * 255.0f));
+    }
+    return table;
+  }
+
+  // curve: 16 comma separated output grays for input grays 0, 17, 34, ... 255, interpolated linearly in between
+  static std::optional<Table> fromCurve(const std::string& curve) {
+    std::array<long, curvePoints> points{};
+    const char* it = curve.c_str();
+    for (std::size_t i = 0; i < points.size(); i++) {
+      char* end = nullptr;
+      points[i] = std::strtol(it, &end, 10);
+      if (end == it || points[i] < 0 || points[i] > 255) return std::nullopt;
+
+      it = end;
+      const bool isLast = i == points.size() - 1;
+      if (isLast ? *it != '\0' : *it++ != ',') return std::nullopt;
+    }
+
+    constexpr std::size_t step = 255 / (curvePoints - 1);
+    Table table{};
+    for (std::size_t i = 0; i < table.size(); i++) {
+      const std::size_t segment = std::min(i / step, curvePoints - 2);
+      const long from = points[segment];
+      const long to = points[segment + 1];
+      const long delta = (to - from) * static_cast<long>(i - segment * step);
+      const long rounding = (delta >= 0 ? 1 : -1) * static_cast<long>(step / 2);
+      table[i] = static_cast<uint8_t>(from + (delta + rounding) / static_cast<long>(step));
+    }
+    return table;
+  }
+};
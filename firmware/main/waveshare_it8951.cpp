@@ -9,12 +9,11 @@
 
 const char* TAG_DISPLAY = "display";
 
-constexpr int pixelDmaBufferSize = 1200 * 25; // NOTE usable only for 9.7" display (1200x825)
 constexpr int generalDmaBufferSize = 256;
 
-WaveshareIT8951::WaveshareIT8951(const Pins& pinConfig, const Power& power) :
+WaveshareIT8951::WaveshareIT8951(const Pins& pinConfig, const Power& power, std::size_t pixelBufferSize) :
   _generalDmaBuffer{make_dma_buffer<generalDmaBufferSize>()},
-  _pixelDmaBuffer{make_dma_buffer<pixelDmaBufferSize>()},
+  _pixelDmaBuffer{make_dma_buffer(pixelBufferSize)},
   _selectedBuffer{&_generalDmaBuffer},
   _pinConfig{pinConfig},
   _power{power} {
@@ -176,6 +175,23 @@ essentials::Span<uint8_t> WaveshareIT8951::readBytes(int readSize) {
   return performTransaction(false, readSize);
 }
 
+essentials::Span<uint8_t> WaveshareIT8951::readPixelBuffer(int readSize) {
+  logD(TAG_DISPLAY, "read pix buff %d", readSize);
+
+  waitForReady();
+
+  performTransaction(true, 0, Operation::READ);
+  waitForReady();
+  performTransaction(true, 0, uint16_t{0});
+  waitForReady();
+
+  _selectedBuffer = &_pixelDmaBuffer;
+  auto data = performBufferTransaction(false, readSize, 0);
+  _selectedBuffer = &_generalDmaBuffer;
+
+  return data;
+}
+
 void WaveshareIT8951::writePixelBuffer(int writeSize) {
   logD(TAG_DISPLAY, "write pix buff %d", writeSize);
 
@@ -184,9 +200,22 @@ void WaveshareIT8951::writePixelBuffer(int writeSize) {
   performTransaction(true, 0, Operation::WRITE);
   waitForReady();
 
-  _selectedBuffer = &_pixelDmaBuffer;
-  performBufferTransaction(false, 0, writeSize);
-  _selectedBuffer = &_generalDmaBuffer;
+  const int transferSize = _transferSize > 0 ? _transferSize : writeSize;
+  for (int offset = 0; offset < writeSize; offset += transferSize) {
+    const int size = std::min(transferSize, writeSize - offset);
+
+    // NOTE CS stays active until the last transaction
+    spi_transaction_t trans{};
+    trans.flags = offset + size < writeSize ? SPI_TRANS_CS_KEEP_ACTIVE : 0;
+    trans.length = size * 8; // in bits
+    trans.tx_buffer = _pixelDmaBuffer.data() + offset;
+
+    Exception::check(spi_device_transmit(_spi, &trans));
+  }
+}
+
+void WaveshareIT8951::setTransferSize(int transferSize) {
+  _transferSize = transferSize;
 }
 
 void WaveshareIT8951::writePattern(uint8_t pattern, int writeSize) {
@@ -245,20 +274,46 @@ void WaveshareIT8951::sendImage(uint16_t x, uint16_t y, uint16_t width, uint16_t
   sendCommand(Command::LD_IMG_END);
 }
 
-void WaveshareIT8951::showImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
-  logD(TAG_DISPLAY, "show image %d, %d, %d, %d", x, y, width, height);
+void WaveshareIT8951::readImageRow(uint16_t x, uint16_t y, uint16_t width) {
+  logD(TAG_DISPLAY, "read image row %d, %d, %d", x, y, width);
+
+  // display memory holds 8bpp pixels
+  const uint32_t address = ((_info.bufferAddressH << 16) | _info.bufferAddressL) + y * _info.width + x;
+  const uint32_t wordCount = width / 2;
+
+  sendCommand(Command::MEM_BST_RD_T);
+  writeData(static_cast<uint16_t>(address & 0xffff),
+    static_cast<uint16_t>(address >> 16),
+    static_cast<uint16_t>(wordCount & 0xffff),
+    static_cast<uint16_t>(wordCount >> 16));
+  sendCommand(Command::MEM_BST_RD_S);
+  auto data = readPixelBuffer(width).data;
+  sendCommand(Command::MEM_BST_END);
+
+  // NOTE read data lie behind the beginning of pixel buffer, so packing in place never overwrites unread pixels.
+  // Words come in big-endian, lower address (left pixel) is in the second byte.
+  uint8_t* packed = _pixelDmaBuffer.data();
+  for (uint32_t i = 0; i < wordCount; i++) {
+    packed[i] = (data[i * 2 + 1] & 0xf0) | (data[i * 2] >> 4);
+  }
+}
 
-  sendCommand(Command::DPY_BUF_AREA);
-  writeData(x, y, width, height, uint16_t{0}, _info.bufferAddressL, _info.bufferAddressH);
-  waitForDisplayImage();
+void WaveshareIT8951::showImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height, Waveform waveform) {
+  logD(TAG_DISPLAY, "show image %d, %d, %d, %d, mode %d", x, y, width, height, static_cast<int>(waveform));
+
+  if (waveform != Waveform::DU) {
+    sendCommand(Command::DPY_BUF_AREA);
+    writeData(x, y, width, height, static_cast<uint16_t>(Waveform::INIT), _info.bufferAddressL, _info.bufferAddressH);
+    waitForDisplayImage();
+  }
 
   sendCommand(Command::DPY_BUF_AREA);
   // mode is undocumented magic number but:
   // 0 = fill screen with white
   // 2 = use (somehow) greyscale
   // 5 = who knows? but it works
-  constexpr uint16_t mode = 5;
-  writeData(x, y, width, height, mode, _info.bufferAddressL, _info.bufferAddressH);
+  // 1 = direct update (DU) of black and white pixels, ~260 ms without flashing
+  writeData(x, y, width, height, static_cast<uint16_t>(waveform), _info.bufferAddressL, _info.bufferAddressH);
   waitForDisplayImage();
 }
 
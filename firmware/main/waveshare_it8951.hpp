@@ -30,6 +30,16 @@ struct WaveshareIT8951 {
     char lutVersion[16];
   };
 
+  // IT8951 display modes (waveforms)
+  enum class Waveform : uint16_t {
+    INIT = 0, // fills with white
+    DU = 1, // fast, no flashing, black and white only (grays end up black or white)
+    GC16 = 2,
+    GL16 = 3,
+    GLR16 = 4,
+    GLD16 = 5,
+  };
+
 private:
   enum class Operation : uint16_t { COMMAND = 0x6000, WRITE = 0x0000, READ = 0x1000 };
 
@@ -89,19 +99,27 @@ private:
   const Power& _power;
   spi_device_handle_t _spi{};
   Info _info{};
+  int _transferSize{};
 
 public:
-  WaveshareIT8951(const Pins& pinConfig, const Power& power);
+  static constexpr std::size_t defaultPixelBufferSize = 1200 * 25; // NOTE 50 rows of 9.7" display (1200x825) 4bpp
+
+  WaveshareIT8951(const Pins& pinConfig, const Power& power, std::size_t pixelBufferSize = defaultPixelBufferSize);
   void powerUp();
   void disconnect();
   void connect(float vcom);
   Info info() const;
 
   DmaBuffer& pixelBuffer();
+  // pixel buffer is sent in SPI transactions of at most transferSize bytes (multiple of 4), 0 = whole at once
+  void setTransferSize(int transferSize);
   void clearBuffer(int begin = 0, int count = -1, uint8_t value = 0);
 
   void sendImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
-  void showImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+  // reads one row of display memory into beginning of pixel buffer (packed 4bpp as sendImage), x and width must be even
+  void readImageRow(uint16_t x, uint16_t y, uint16_t width);
+  // default clears the area to white first, then draws 16 grays; DU updates the area in place without flashing
+  void showImage(uint16_t x, uint16_t y, uint16_t width, uint16_t height, Waveform waveform = Waveform::GLD16);
   void clear();
 
 private:
@@ -115,6 +133,7 @@ private:
   void sendCommand(Command command);
 
   essentials::Span<uint8_t> readBytes(int readSize);
+  essentials::Span<uint8_t> readPixelBuffer(int readSize);
   void writePixelBuffer(int writeSize);
   void writePattern(uint8_t pattern, int writeSize);
 
@@ -0,0 +1,171 @@
+#include "wifi_cache.hpp"
+
+#include "esp_netif_net_stack.h"
+#include "esp_wifi.h"
+#include "lwip/dhcp.h"
+#include "simple_logger.hpp"
+
+#include <cstring>
+#include <sys/time.h>
+
+const char* TAG_WIFI_CACHE = "wifiCache";
+
+namespace {
+// when DHCP doesn't tell
+constexpr uint32_t defaultLeaseTime = 60 * 60;
+
+int64_t rtcTime() {
+  timeval now{};
+  gettimeofday(&now, nullptr);
+  return now.tv_sec;
+}
+
+WifiCache* activeCache{};
+
+esp_netif_t* stationInterface() {
+  return esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+}
+} // namespace
+
+extern "C" {
+esp_err_t __real_esp_wifi_connect();
+
+// NOTE linked instead of esp_wifi_connect() (-Wl,--wrap), which calls __real_esp_wifi_connect()
+esp_err_t __wrap_esp_wifi_connect() {
+  if (activeCache != nullptr) activeCache->beforeConnect();
+  return __real_esp_wifi_connect();
+}
+}
+
+WifiCache::WifiCache(Lease& lease) : _lease{lease} {
+  activeCache = this;
+}
+
+bool WifiCache::apply() {
+  _isUsed = false;
+  _isAccessPointUsed = false;
+  if (_lease.ip == 0) return false;
+
+  // NOTE time set by SNTP in the meantime moves RTC time, lease is renewed then
+  const int64_t elapsed = rtcTime() - _lease.obtainedTime;
+  if (elapsed < 0 || elapsed >= _lease.leaseTime / 2) {
+    logI(TAG_WIFI_CACHE, "cached lease is due to renewal");
+    invalidate();
+    return false;
+  }
+
+  auto onDisconnect = [](void* cache, esp_event_base_t, int32_t, void*) {
+    static_cast<WifiCache*>(cache)->onStationDisconnect();
+  };
+  if (esp_event_handler_instance_register(
+        WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, onDisconnect, this, &_onDisconnect) != ESP_OK) {
+    logW(TAG_WIFI_CACHE, "cached lease not used, station events can't be handled");
+    return false;
+  }
+  _isPending = true;
+  return true;
+}
+
+void WifiCache::store() {
+  stopApplying();
+  if (_isUsed) return;
+
+  esp_netif_t* netif = stationInterface();
+  esp_netif_ip_info_t ipInfo{};
+  esp_netif_dns_info_t dnsInfo{};
+  if (netif == nullptr || esp_netif_get_ip_info(netif, &ipInfo) != ESP_OK || ipInfo.ip.addr == 0) return;
+  if (esp_netif_get_dns_info(netif, ESP_NETIF_DNS_MAIN, &dnsInfo) != ESP_OK) return;
+
+  uint32_t leaseTime = defaultLeaseTime;
+  const auto* lwipNetif = static_cast<const struct netif*>(esp_netif_get_netif_impl(netif));
+  const dhcp* dhcpData = lwipNetif != nullptr ? netif_dhcp_data(lwipNetif) : nullptr;
+  if (dhcpData != nullptr && dhcpData->offered_t0_lease > 0) leaseTime = dhcpData->offered_t0_lease;
+
+  wifi_ap_record_t accessPoint{};
+  const bool hasAccessPoint = esp_wifi_sta_get_ap_info(&accessPoint) == ESP_OK;
+
+  _lease = {ipInfo.ip.addr, ipInfo.netmask.addr, ipInfo.gw.addr, dnsInfo.ip.u_addr.ip4.addr, rtcTime(), leaseTime};
+  if (hasAccessPoint) {
+    std::memcpy(_lease.bssid, accessPoint.bssid, sizeof(_lease.bssid));
+    _lease.channel = accessPoint.primary;
+  }
+  logI(TAG_WIFI_CACHE, "cached lease " IPSTR " for %d s, channel %d", IP2STR(&ipInfo.ip), leaseTime, _lease.channel);
+}
+
+void WifiCache::invalidate() {
+  stopApplying();
+  _lease = {};
+}
+
+bool WifiCache::isUsed() const {
+  return _isUsed;
+}
+
+bool WifiCache::isAccessPointUsed() const {
+  return _isAccessPointUsed;
+}
+
+void WifiCache::beforeConnect() {
+  // NOTE reconnects of es::Wifi and the fallback connect as configured by the first one
+  if (!_isPending.exchange(false)) return;
+
+  esp_netif_t* netif = stationInterface();
+  if (netif == nullptr) {
+    logW(TAG_WIFI_CACHE, "no WIFI_STA_DEF interface, cached lease not used");
+    return;
+  }
+
+  // NOTE stopped DHCP client makes the network interface use static IP once WiFi is connected
+  const esp_err_t stopResult = esp_netif_dhcpc_stop(netif);
+  if (stopResult != ESP_OK && stopResult != ESP_ERR_ESP_NETIF_DHCP_ALREADY_STOPPED) return;
+
+  esp_netif_ip_info_t ipInfo{};
+  ipInfo.ip.addr = _lease.ip;
+  ipInfo.netmask.addr = _lease.netmask;
+  ipInfo.gw.addr = _lease.gateway;
+  esp_netif_dns_info_t dnsInfo{};
+  dnsInfo.ip.type = ESP_IPADDR_TYPE_V4;
+  dnsInfo.ip.u_addr.ip4.addr = _lease.dns;
+  if (esp_netif_set_ip_info(netif, &ipInfo) != ESP_OK ||
+    esp_netif_set_dns_info(netif, ESP_NETIF_DNS_MAIN, &dnsInfo) != ESP_OK) {
+    esp_netif_dhcpc_start(netif);
+    return;
+  }
+
+  _isAccessPointUsed = _lease.channel != 0 && setAccessPoint(true);
+  logI(TAG_WIFI_CACHE, "using cached lease " IPSTR ", channel %d", IP2STR(&ipInfo.ip), _lease.channel);
+  _isUsed = true;
+}
+
+void WifiCache::onStationDisconnect() {
+  if (!_isUsed) return;
+
+  logW(TAG_WIFI_CACHE, "disconnected with cached lease, connecting by scan and DHCP");
+  _isUsed = false;
+  _isAccessPointUsed = false;
+  _lease = {};
+  setAccessPoint(false);
+  esp_netif_t* netif = stationInterface();
+  if (netif != nullptr) esp_netif_dhcpc_start(netif);
+  // NOTE connect of es::Wifi reconnecting as well fails harmlessly while this one is in progress
+  esp_wifi_connect();
+}
+
+void WifiCache::stopApplying() {
+  _isPending = false;
+  if (_onDisconnect != nullptr) {
+    esp_event_handler_instance_unregister(WIFI_EVENT, WIFI_EVENT_STA_DISCONNECTED, _onDisconnect);
+  }
+  _onDisconnect = nullptr;
+}
+
+bool WifiCache::setAccessPoint(bool isCached) {
+  wifi_config_t config{};
+  if (esp_wifi_get_config(WIFI_IF_STA, &config) != ESP_OK) return false;
+
+  // NOTE fast scan on the given channel stops at the access point, other channels aren't scanned
+  config.sta.bssid_set = isCached;
+  config.sta.channel = isCached ? _lease.channel : 0;
+  if (isCached) std::memcpy(config.sta.bssid, _lease.bssid, sizeof(config.sta.bssid));
+  return esp_wifi_set_config(WIFI_IF_STA, &config) == ESP_OK;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "esp_event.h"
+#include "esp_netif.h"
+
+#include <atomic>
+#include <cstdint>
+
+// DHCP lease and access point of a network wake kept in RTC memory. Following wakes configure the lease as static IP
+// and connect to the same access point (BSSID) on its channel without scanning, so the connection doesn't wait for
+// all channel scan and DHCP exchange. Lease is used until its renewal time (half of lease time) or until a wake with
+// cached lease fails to reach MQTT broker (address taken, other network), then DHCP runs again. Station which
+// disconnects before it gets connected with cached lease (access point replaced) falls back to scan and DHCP.
+//
+// Station interface and its configuration are set up by es::Wifi, which doesn't take static IP or access point.
+// esp_wifi_connect() is wrapped by linker (see CMakeLists.txt), cached lease and access point are applied right before
+// the first connect of the wake.
+class WifiCache {
+public:
+  // survives deep sleep, zero after power on
+  struct Lease {
+    uint32_t ip; // network byte order as esp_ip4_addr_t
+    uint32_t netmask;
+    uint32_t gateway;
+    uint32_t dns;
+    int64_t obtainedTime; // RTC time in seconds
+    uint32_t leaseTime; // seconds
+    uint8_t bssid[6];
+    uint8_t channel; // 0 = access point isn't known
+  };
+
+private:
+  Lease& _lease;
+  esp_event_handler_instance_t _onDisconnect{};
+  std::atomic<bool> _isPending{};
+  std::atomic<bool> _isUsed{};
+  std::atomic<bool> _isAccessPointUsed{};
+
+public:
+  explicit WifiCache(Lease& lease);
+
+  // before WiFi connects, returns true when cached lease is going to be applied by the first connect
+  bool apply();
+  // after WiFi is connected by DHCP, keeps its lease for next wakes
+  void store();
+  // next wake runs DHCP
+  void invalidate();
+
+  bool isUsed() const;
+  // the station connected to cached access point without all channel scan
+  bool isAccessPointUsed() const;
+
+  // esp_wifi_connect() calls it on the task which connects
+  void beforeConnect();
+
+private:
+  // event handler, it runs on event loop task
+  void onStationDisconnect();
+
+  void stopApplying();
+  bool setAccessPoint(bool isCached);
+};
@@ -0,0 +1,423 @@
+// Host benchmark and golden-image suite of PNG decode -> dither -> 4bpp strip packing, the path of App::drawPixel.
+//
+// Every PNG of the corpus is decoded by pngle (bundled miniz inflate) and its pixels go through tone curve, Ditherer
+// and StripPacker (InterlacedBandWriter for Adam7) into a 4bpp frame as the device writes to display memory. Hash of
+// the frame is compared with corpus/golden.txt, so a decoder or packer change which alters the output fails the run.
+//
+// cmake -S . -B build && cmake --build build && ./build/decode_benchmark corpus [--repetitions N] [--update]
+//
+// --update rewrites golden.txt from current output (check the frames first). Corpus is generated by makeCorpus.js.
+// Times are host times, they tell relative changes of the pipeline, not milliseconds on the ESP32.
+
+#include "dither.hpp"
+#include "frame_hash.hpp"
+#include "interlaced_band_writer.hpp"
+#include "pngle/pngle.h"
+#include "strip_packer.hpp"
+#include "tone_curve.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_CYCLE_COUNTER 1
+#endif
+
+namespace fs = std::filesystem;
+
+constexpr std::size_t pixelBufferSize = 1200 * 25; // WaveshareIT8951::defaultPixelBufferSize
+constexpr std::size_t decodeChunkSize = 2048; // App::decodeChunk
+constexpr int defaultRepetitions = 20;
+constexpr const char* goldenFileName = "golden.txt";
+
+struct Frame {
+  uint32_t width{};
+  uint32_t height{};
+  std::vector<uint8_t> pixels{}; // packed 4bpp, left pixel in high nibble
+
+  uint32_t hash() const {
+    FrameHash hash;
+    hash.update(pixels.data(), pixels.size());
+    return hash.value;
+  }
+};
+
+// App image pipeline without the display: strips and bands are written to frame instead of display memory
+class Pipeline {
+  ToneCurve::Table _toneCurve = ToneCurve::identity();
+  Ditherer _ditherer{};
+  Ditherer::Mode _ditherMode{Ditherer::Mode::NONE};
+  std::vector<uint8_t> _pixelBuffer = std::vector<uint8_t>(pixelBufferSize);
+  StripPacker<4> _stripPacker{_pixelBuffer.data(), _pixelBuffer.size(), [this](uint32_t y, uint32_t rows) {
+                                writeRows(y, rows, _pixelBuffer.data());
+                              }};
+  InterlacedBandWriter _interlacedWriter{_pixelBuffer.data(),
+    _pixelBuffer.size(),
+    [this](uint16_t y, uint8_t* row) { std::copy_n(_frame.pixels.begin() + y * rowSize(), rowSize(), row); },
+    [this](uint16_t y, uint16_t height, const uint8_t* band) { writeRows(y, height, band); }};
+
+  pngle_t* _pngle{};
+  Frame _frame{};
+  bool _isInterlaced{};
+  std::string _pngChunk{};
+
+public:
+  // returns nullopt on decoder error (printed)
+  std::optional<Frame> decode(const std::vector<uint8_t>& png) {
+    _ditherMode = Ditherer::Mode::NONE;
+    _frame = {};
+    _pngle = pngle_new();
+    pngle_set_user_data(_pngle, this);
+
+    pngle_set_init_callback(_pngle, [](pngle_t* pngle, uint32_t w, uint32_t h) {
+      auto pipeline = static_cast<Pipeline*>(pngle_get_user_data(pngle));
+      // NOTE display memory is white before the image is drawn
+      pipeline->_frame = {w, h, std::vector<uint8_t>(StripPacker<4>::rowSize(w) * h, 0xff)};
+    });
+
+    pngle_set_draw_callback(_pngle,
+      [](pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
+        static_cast<Pipeline*>(pngle_get_user_data(pngle))->drawPixel(x, y, w, h, rgba);
+      });
+
+    pngle_set_done_callback(_pngle, [](pngle_t* pngle) {
+      auto pipeline = static_cast<Pipeline*>(pngle_get_user_data(pngle));
+      pipeline->_ditherer.end();
+      if (pipeline->_isInterlaced) pipeline->_interlacedWriter.flush();
+    });
+
+    pngle_set_chunk_callback(_pngle,
+      [](pngle_t* pngle, uint32_t type, const uint8_t* data, size_t len, uint32_t offset, uint32_t chunkLength) {
+        static_cast<Pipeline*>(pngle_get_user_data(pngle))->readPngChunk(type, data, len, offset, chunkLength);
+      });
+
+    const bool isDecoded = feed(png);
+    pngle_destroy(_pngle);
+    _pngle = nullptr;
+    if (!isDecoded) return std::nullopt;
+    return std::move(_frame);
+  }
+
+private:
+  // network chunks are fed piece by piece, bytes which pngle doesn't consume yet go with the next piece
+  bool feed(const std::vector<uint8_t>& png) {
+    std::vector<uint8_t> piece(decodeChunkSize);
+    std::size_t remaining = 0;
+    for (auto it = png.begin(); it != png.end() || remaining > 0;) {
+      const std::size_t size = std::min<std::size_t>(png.end() - it, piece.size() - remaining);
+      std::copy_n(it, size, piece.begin() + remaining);
+      it += size;
+
+      const int fed = pngle_feed(_pngle, piece.data(), remaining + size);
+      if (fed < 0) {
+        std::fprintf(stderr, "pngle error: %s\n", pngle_error(_pngle));
+        return false;
+      }
+      remaining += size - fed;
+      if (size == 0 && fed == 0) break; // truncated image
+      std::memmove(piece.data(), piece.data() + fed, remaining);
+    }
+    return true;
+  }
+
+  uint32_t rowSize() const {
+    return StripPacker<4>::rowSize(_frame.width);
+  }
+
+  void writeRows(uint32_t y, uint32_t rows, const uint8_t* pixels) {
+    std::copy_n(pixels, rows * rowSize(), _frame.pixels.begin() + y * rowSize());
+  }
+
+  void drawPixel(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
+    if (x == 0 && y == 0) beginPixels();
+
+    const uint8_t level = _ditherer.quantize(x, y, _toneCurve[rgba[0]]);
+    if (_isInterlaced) {
+      _interlacedWriter.draw(x, y, w, h, level);
+    } else {
+      _stripPacker.push(level);
+    }
+  }
+
+  void beginPixels() {
+    _isInterlaced = pngle_get_ihdr(_pngle)->interlace != 0;
+    if (_isInterlaced) {
+      _interlacedWriter.begin(_frame.width);
+    } else {
+      _stripPacker.begin(_frame.width, _frame.height);
+    }
+
+    auto mode = _ditherMode;
+    const bool isErrorDiffusion = mode == Ditherer::Mode::FLOYD_STEINBERG || mode == Ditherer::Mode::ATKINSON;
+    if (isErrorDiffusion && _isInterlaced) mode = Ditherer::Mode::BAYER;
+    _ditherer.begin(mode, _frame.width);
+  }
+
+  // "dither" tEXt chunk as in App::readPngChunk
+  void readPngChunk(uint32_t type, const uint8_t* data, size_t len, uint32_t offset, uint32_t chunkLength) {
+    constexpr uint32_t textChunkType = 0x74455874; // tEXt
+    constexpr uint32_t maxChunkLength = 64;
+    if (type != textChunkType || chunkLength > maxChunkLength) return;
+
+    if (offset == 0) _pngChunk.clear();
+    _pngChunk.append(reinterpret_cast<const char*>(data), len);
+    if (offset + len != chunkLength) return;
+
+    const std::string_view text{_pngChunk};
+    const auto separator = text.find('\0');
+    if (separator == std::string_view::npos || text.substr(0, separator) != "dither") return;
+    _ditherMode = Ditherer::parseMode(text.substr(separator + 1), _ditherMode);
+  }
+};
+
+struct Golden {
+  uint32_t width;
+  uint32_t height;
+  uint32_t hash;
+};
+
+// lines "<file> <width> <height> <hash>", # starts a comment
+std::map<std::string, Golden> readGolden(const fs::path& path) {
+  std::map<std::string, Golden> golden;
+  std::ifstream file{path};
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') continue;
+
+    char name[256];
+    Golden entry{};
+    if (std::sscanf(line.c_str(), "%255s %u %u %x", name, &entry.width, &entry.height, &entry.hash) == 4) {
+      golden[name] = entry;
+    }
+  }
+  return golden;
+}
+
+void writeGolden(const fs::path& path, const std::map<std::string, Golden>& golden) {
+  std::ofstream file{path};
+  file << "# 4bpp frames of decode_benchmark: <file> <width> <height> <FNV-1a of packed frame>\n";
+  for (const auto& [name, entry] : golden) {
+    char line[320];
+    std::snprintf(line, sizeof(line), "%s %u %u %08x\n", name.c_str(), entry.width, entry.height, entry.hash);
+    file << line;
+  }
+}
+
+std::vector<uint8_t> readFile(const fs::path& path) {
+  std::ifstream file{path, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+double cpuTime() {
+  timespec time{};
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+  return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+uint64_t cycles() {
+#ifdef HAS_CYCLE_COUNTER
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+struct Sample {
+  double time; // s
+  double cpu; // s
+  double cycles;
+};
+
+// per run statistics in the style of Google Benchmark aggregates
+struct Statistics {
+  double mean;
+  double median;
+  double stddev;
+
+  static Statistics of(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    const std::size_t n = values.size();
+    const double median = n % 2 == 1 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+
+    double sum = 0;
+    for (const double value : values) sum += value;
+    const double mean = sum / n;
+
+    double squares = 0;
+    for (const double value : values) squares += (value - mean) * (value - mean);
+    const double stddev = n > 1 ? std::sqrt(squares / (n - 1)) : 0;
+    return {mean, median, stddev};
+  }
+};
+
+void printHeader() {
+  std::printf("%-46s %11s %11s %6s %9s %8s %10s\n", "Benchmark", "Time", "CPU", "Runs", "MB/s", "ns/px", "cycles/px");
+  std::printf("%s\n", std::string(107, '-').c_str());
+}
+
+void printStatistics(
+  const std::string& name, const Frame& frame, std::size_t pngSize, const std::vector<Sample>& runs) {
+  std::vector<double> times, cpus, rates, cycles;
+  for (const auto& run : runs) {
+    times.push_back(run.time);
+    cpus.push_back(run.cpu);
+    rates.push_back(pngSize / run.time / 1e6);
+    cycles.push_back(run.cycles);
+  }
+  const auto time = Statistics::of(times);
+  const auto cpu = Statistics::of(cpus);
+  const auto rate = Statistics::of(rates);
+  const auto cycle = Statistics::of(cycles);
+  const double pixels = static_cast<double>(frame.width) * frame.height;
+
+  // NOTE throughput is of compressed input (as it comes from network)
+  const auto print = [&](const char* aggregate, double t, double c, double mbs, double cy) {
+    const std::string label = "decode/" + name + "_" + aggregate;
+#ifdef HAS_CYCLE_COUNTER
+    const double cyclesPerPixel = cy / pixels;
+#else
+    const double cyclesPerPixel = NAN;
+#endif
+    std::printf("%-46s %8.3f ms %8.3f ms %6zu %9.2f %8.2f %10.2f\n",
+      label.c_str(),
+      t * 1e3,
+      c * 1e3,
+      runs.size(),
+      mbs,
+      t * 1e9 / pixels,
+      cyclesPerPixel);
+  };
+
+  print("mean", time.mean, cpu.mean, rate.mean, cycle.mean);
+  print("median", time.median, cpu.median, rate.median, cycle.median);
+  print("stddev", time.stddev, cpu.stddev, rate.stddev, cycle.stddev);
+  std::printf("%-46s %9.2f %% %9.2f %% %6zu %7.2f %%\n",
+    ("decode/" + name + "_cv").c_str(),
+    time.stddev / time.mean * 100,
+    cpu.stddev / cpu.mean * 100,
+    runs.size(),
+    rate.stddev / rate.mean * 100);
+}
+
+void printUsage(const char* program) {
+  std::fprintf(stderr, "usage: %s <corpus dir> [--repetitions N] [--update]\n", program);
+}
+
+int main(int argc, char** argv) {
+  std::optional<fs::path> corpusDir;
+  int repetitions = defaultRepetitions;
+  bool isUpdate = false;
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg{argv[i]};
+    if (arg == "--update") {
+      isUpdate = true;
+    } else if (arg == "--repetitions" && i + 1 < argc) {
+      repetitions = std::max(1, std::atoi(argv[++i]));
+    } else if (!corpusDir && !arg.starts_with("--")) {
+      corpusDir = fs::path{arg};
+    } else {
+      printUsage(argv[0]);
+      return 2;
+    }
+  }
+  if (!corpusDir) corpusDir = fs::path{"corpus"};
+  std::error_code error;
+  if (!fs::is_directory(*corpusDir, error)) {
+    std::fprintf(stderr, "corpus directory %s not found\n", corpusDir->c_str());
+    printUsage(argv[0]);
+    return 2;
+  }
+
+  std::vector<fs::path> images;
+  for (const auto& entry : fs::directory_iterator{*corpusDir}) {
+    if (entry.path().extension() == ".png") images.push_back(entry.path());
+  }
+  std::sort(images.begin(), images.end());
+  if (images.empty()) {
+    std::fprintf(stderr, "no PNG images in %s\n", corpusDir->c_str());
+    return 2;
+  }
+
+  const fs::path goldenPath = *corpusDir / goldenFileName;
+  auto golden = isUpdate ? std::map<std::string, Golden>{} : readGolden(goldenPath);
+  Pipeline pipeline;
+  int failures = 0;
+
+  printHeader();
+  for (const auto& path : images) {
+    const std::string name = path.filename().string();
+    const auto png = readFile(path);
+
+    const auto frame = pipeline.decode(png);
+    if (!frame) {
+      std::printf("%-46s FAILED to decode\n", ("decode/" + name).c_str());
+      failures++;
+      continue;
+    }
+
+    const Golden result{frame->width, frame->height, frame->hash()};
+    if (isUpdate) {
+      golden[name] = result;
+    } else if (const auto it = golden.find(name); it == golden.end()) {
+      std::printf("%-46s no golden frame (run with --update)\n", ("decode/" + name).c_str());
+      failures++;
+    } else if (it->second.width != result.width || it->second.height != result.height ||
+               it->second.hash != result.hash) {
+      std::printf("%-46s MISMATCH %ux%u %08x, golden %ux%u %08x\n",
+        ("decode/" + name).c_str(),
+        result.width,
+        result.height,
+        result.hash,
+        it->second.width,
+        it->second.height,
+        it->second.hash);
+      failures++;
+    }
+
+    std::vector<Sample> runs;
+    for (int i = 0; i < repetitions; i++) {
+      const auto start = std::chrono::steady_clock::now();
+      const double cpuStart = cpuTime();
+      const uint64_t cyclesStart = cycles();
+      const auto decoded = pipeline.decode(png);
+      const uint64_t cyclesEnd = cycles();
+      const double cpuEnd = cpuTime();
+      const auto end = std::chrono::steady_clock::now();
+
+      if (!decoded || decoded->hash() != result.hash) {
+        std::printf("%-46s output differs between runs\n", ("decode/" + name).c_str());
+        failures++;
+        break;
+      }
+      runs.push_back({std::chrono::duration<double>(end - start).count(),
+        cpuEnd - cpuStart,
+        static_cast<double>(cyclesEnd - cyclesStart)});
+    }
+    if (!runs.empty()) printStatistics(name, *frame, png.size(), runs);
+  }
+
+  if (isUpdate) {
+    writeGolden(goldenPath, golden);
+    std::printf("golden frames written to %s\n", goldenPath.c_str());
+  }
+#ifdef HAS_CYCLE_COUNTER
+  std::printf("cycles are TSC ticks of the host\n");
+#endif
+  std::printf("%s\n", failures == 0 ? "all frames match golden" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,282 @@
+import fs from "fs"
+import path from "path"
+import zlib from "zlib"
+import { fileURLToPath } from "url"
+
+// Generates PNG corpus of decode_benchmark: synthetic dashboard in 16 gray levels (display levels) encoded as 8 bit
+// gray, 4 bit gray, 16 color palette and Adam7 interlaced 8 bit gray, which all have to pack to the same 4bpp frame,
+// and continuous tone "photo" with device dithering (Floyd-Steinberg, Bayer when interlaced).
+//
+// node makeCorpus.js [output dir, default ./corpus]
+//
+// No dependencies, so the corpus doesn't change with encoder versions. Rows are filtered by minimum sum of absolute
+// differences like libpng and deflated at level 9.
+
+const WIDTH = 1200
+const HEIGHT = 825
+const PHOTO_WIDTH = 600
+const PHOTO_HEIGHT = 400
+const LEVEL_STEP = 17 // 255 / 15
+
+const ColorType = { GRAY: 0, INDEXED: 3 }
+
+const crcTable = Array.from({ length: 256 }, (_, n) => {
+  let c = n
+  for (let k = 0; k < 8; k++) c = c & 1 ? 0xedb88320 ^ (c >>> 1) : c >>> 1
+  return c >>> 0
+})
+
+const crc32 = (buffer) => {
+  let crc = 0xffffffff
+  for (const byte of buffer) crc = crcTable[(crc ^ byte) & 0xff] ^ (crc >>> 8)
+  return (crc ^ 0xffffffff) >>> 0
+}
+
+const chunk = (type, data) => {
+  const typeAndData = Buffer.concat([Buffer.from(type, "ascii"), data])
+  const header = Buffer.alloc(4)
+  header.writeUInt32BE(data.length)
+  const crc = Buffer.alloc(4)
+  crc.writeUInt32BE(crc32(typeAndData))
+  return Buffer.concat([header, typeAndData, crc])
+}
+
+// gray: 8 bit pixels, row-major
+class Image {
+  constructor(width, height) {
+    this.width = width
+    this.height = height
+    this.gray = new Uint8Array(width * height).fill(255)
+  }
+
+  fill(x, y, w, h, gray) {
+    for (let row = Math.max(y, 0); row < Math.min(y + h, this.height); row++) {
+      this.gray.fill(gray, row * this.width + Math.max(x, 0), row * this.width + Math.min(x + w, this.width))
+    }
+  }
+
+  frame(x, y, w, h, thickness, gray) {
+    this.fill(x, y, w, thickness, gray)
+    this.fill(x, y + h - thickness, w, thickness, gray)
+    this.fill(x, y, thickness, h, gray)
+    this.fill(x + w - thickness, y, thickness, h, gray)
+  }
+}
+
+// deterministic pseudo random numbers (LCG), same corpus on every run
+const random = (seed) => () => {
+  seed = (Math.imul(seed, 1664525) + 1013904223) >>> 0
+  return seed / 0x100000000
+}
+
+const level = (l) => l * LEVEL_STEP
+
+// word-like blocks of text line with letter gaps
+const drawText = (image, x, y, width, size, gray, next) => {
+  let cursor = x
+  while (cursor < x + width) {
+    const letters = 2 + Math.floor(next() * 7)
+    for (let i = 0; i < letters && cursor < x + width; i++) {
+      const letterWidth = Math.round(size * (0.4 + next() * 0.3))
+      const ascender = next() < 0.3 ? Math.round(size * 0.3) : 0
+      image.fill(cursor, y + Math.round(size * 0.3) - ascender, letterWidth, Math.round(size * 0.7) + ascender, gray)
+      cursor += letterWidth + Math.max(1, Math.round(size * 0.1))
+    }
+    cursor += Math.round(size * 0.4)
+  }
+}
+
+const SEGMENTS = [0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07, 0x7f, 0x6f] // gfedcba
+
+const drawDigit = (image, x, y, w, h, digit, gray) => {
+  const t = Math.max(2, Math.round(w / 6))
+  const half = Math.round(h / 2)
+  const segments = [
+    [x, y, w, t],
+    [x + w - t, y, t, half],
+    [x + w - t, y + half, t, h - half],
+    [x, y + h - t, w, t],
+    [x, y + half, t, h - half],
+    [x, y, t, half],
+    [x, y + half - Math.round(t / 2), w, t],
+  ]
+  segments.forEach(([sx, sy, sw, sh], i) => {
+    if (SEGMENTS[digit] & (1 << i)) image.fill(sx, sy, sw, sh, gray)
+  })
+}
+
+const drawDashboard = () => {
+  const image = new Image(WIDTH, HEIGHT)
+  const next = random(2022)
+
+  // header bar with title and clock
+  image.fill(0, 0, WIDTH, 64, level(0))
+  drawText(image, 24, 16, 520, 32, level(15), next)
+  ;[1, 2, 4, 5].forEach((digit, i) => drawDigit(image, 1000 + i * 46 + (i > 1 ? 16 : 0), 12, 34, 40, digit, level(15)))
+
+  // cards with title, big value and text lines
+  const cardWidth = 380
+  const cardHeight = 230
+  for (let row = 0; row < 2; row++) {
+    for (let column = 0; column < 3; column++) {
+      const x = 20 + column * (cardWidth + 10)
+      const y = 84 + row * (cardHeight + 10)
+      image.fill(x, y, cardWidth, cardHeight, level(14))
+      image.frame(x, y, cardWidth, cardHeight, 3, level(0))
+      drawText(image, x + 16, y + 14, 220, 22, level(4), next)
+      for (let i = 0; i < 3; i++) {
+        drawDigit(image, x + 16 + i * 70, y + 56, 56, 96, Math.floor(next() * 10), level(0))
+      }
+      for (let line = 0; line < 3; line++) {
+        drawText(image, x + 16, y + 166 + line * 18, cardWidth - 40, 14, level(6 + line * 2), next)
+      }
+    }
+  }
+
+  // bar chart
+  const chartY = 580
+  image.frame(20, chartY, 760, 225, 2, level(0))
+  for (let i = 0; i < 36; i++) {
+    const barHeight = Math.round(20 + next() * 180)
+    image.fill(36 + i * 20, chartY + 215 - barHeight, 14, barHeight, level(3 + (i % 10)))
+  }
+
+  // posterized radial gradient, photo area of the dashboard
+  const cx = 990
+  const cy = 692
+  for (let y = chartY; y < chartY + 225; y++) {
+    for (let x = 800; x < WIDTH - 20; x++) {
+      const distance = Math.hypot(x - cx, (y - cy) * 1.6)
+      image.gray[y * WIDTH + x] = level(Math.min(15, Math.floor(distance / 14)))
+    }
+  }
+  return image
+}
+
+const drawPhoto = () => {
+  const image = new Image(PHOTO_WIDTH, PHOTO_HEIGHT)
+  const next = random(7)
+  for (let y = 0; y < PHOTO_HEIGHT; y++) {
+    for (let x = 0; x < PHOTO_WIDTH; x++) {
+      const sky = 235 - (y * 120) / PHOTO_HEIGHT
+      const hills = 60 * Math.sin(x / 47) * Math.sin(y / 31) + 30 * Math.cos((x + y) / 19)
+      const grain = (next() - 0.5) * 6
+      image.gray[y * PHOTO_WIDTH + x] = Math.max(0, Math.min(255, Math.round(sky + hills + grain)))
+    }
+  }
+  return image
+}
+
+// Adam7 passes: x0, y0, dx, dy
+const ADAM7 = [
+  [0, 0, 8, 8],
+  [4, 0, 8, 8],
+  [0, 4, 4, 8],
+  [2, 0, 4, 4],
+  [0, 2, 2, 4],
+  [1, 0, 2, 2],
+  [0, 1, 1, 2],
+]
+
+const packRow = (values, bitDepth) => {
+  const row = Buffer.alloc(Math.ceil((values.length * bitDepth) / 8))
+  values.forEach((value, i) => {
+    const bit = i * bitDepth
+    row[bit >> 3] |= value << (8 - bitDepth - (bit & 7))
+  })
+  return row
+}
+
+const paeth = (a, b, c) => {
+  const p = a + b - c
+  const pa = Math.abs(p - a)
+  const pb = Math.abs(p - b)
+  const pc = Math.abs(p - c)
+  if (pa <= pb && pa <= pc) return a
+  return pb <= pc ? b : c
+}
+
+// filters every row with the filter of minimum sum of absolute (signed) differences
+const filterRows = (rows) => {
+  const out = []
+  let previous = null
+  for (const row of rows) {
+    const up = previous ?? Buffer.alloc(row.length)
+    const candidates = [0, 1, 2, 3, 4].map((type) => {
+      const filtered = Buffer.alloc(row.length + 1)
+      filtered[0] = type
+      for (let i = 0; i < row.length; i++) {
+        const a = i > 0 ? row[i - 1] : 0
+        const b = up[i]
+        const c = i > 0 ? up[i - 1] : 0
+        const predictor = [0, a, b, (a + b) >> 1, paeth(a, b, c)][type]
+        filtered[i + 1] = (row[i] - predictor) & 0xff
+      }
+      return filtered
+    })
+    const cost = (filtered) => filtered.subarray(1).reduce((sum, byte) => sum + (byte < 128 ? byte : 256 - byte), 0)
+    out.push(candidates.reduce((best, filtered) => (cost(filtered) < cost(best) ? filtered : best)))
+    previous = row
+  }
+  return out
+}
+
+// toValue maps 8 bit gray to sample (gray value of bit depth or palette index)
+const encodePng = (image, { colorType, bitDepth, interlace = false, text = null }) => {
+  const toValue = (gray) => (colorType === ColorType.INDEXED ? gray / LEVEL_STEP : gray >> (8 - bitDepth))
+
+  const passes = interlace ? ADAM7 : [[0, 0, 1, 1]]
+  const filtered = passes.flatMap(([x0, y0, dx, dy]) => {
+    const rows = []
+    for (let y = y0; y < image.height; y += dy) {
+      const values = []
+      for (let x = x0; x < image.width; x += dx) values.push(toValue(image.gray[y * image.width + x]))
+      if (values.length > 0) rows.push(packRow(values, bitDepth))
+    }
+    return filterRows(rows)
+  })
+
+  const ihdr = Buffer.alloc(13)
+  ihdr.writeUInt32BE(image.width, 0)
+  ihdr.writeUInt32BE(image.height, 4)
+  ihdr.writeUInt8(bitDepth, 8)
+  ihdr.writeUInt8(colorType, 9)
+  ihdr.writeUInt8(interlace ? 1 : 0, 12)
+
+  const chunks = [chunk("IHDR", ihdr)]
+  if (text) chunks.push(chunk("tEXt", Buffer.from(`${text.keyword}\0${text.value}`, "latin1")))
+  if (colorType === ColorType.INDEXED) {
+    const palette = Buffer.alloc(16 * 3)
+    for (let i = 0; i < 16; i++) palette.fill(level(i), i * 3, i * 3 + 3)
+    chunks.push(chunk("PLTE", palette))
+  }
+  chunks.push(chunk("IDAT", zlib.deflateSync(Buffer.concat(filtered), { level: 9 })))
+  chunks.push(chunk("IEND", Buffer.alloc(0)))
+
+  return Buffer.concat([Buffer.from([0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a]), ...chunks])
+}
+
+const main = () => {
+  const outputDir = process.argv[2] ?? path.join(path.dirname(fileURLToPath(import.meta.url)), "corpus")
+  fs.mkdirSync(outputDir, { recursive: true })
+
+  const dashboard = drawDashboard()
+  const photo = drawPhoto()
+  const dither = { keyword: "dither", value: "floyd-steinberg" }
+
+  const corpus = {
+    "dashboard_gray8.png": encodePng(dashboard, { colorType: ColorType.GRAY, bitDepth: 8 }),
+    "dashboard_gray4.png": encodePng(dashboard, { colorType: ColorType.GRAY, bitDepth: 4 }),
+    "dashboard_indexed4.png": encodePng(dashboard, { colorType: ColorType.INDEXED, bitDepth: 4 }),
+    "dashboard_interlaced.png": encodePng(dashboard, { colorType: ColorType.GRAY, bitDepth: 8, interlace: true }),
+    "photo_gray8.png": encodePng(photo, { colorType: ColorType.GRAY, bitDepth: 8, text: dither }),
+    "photo_interlaced.png": encodePng(photo, { colorType: ColorType.GRAY, bitDepth: 8, interlace: true, text: dither }),
+  }
+
+  for (const [name, png] of Object.entries(corpus)) {
+    fs.writeFileSync(path.join(outputDir, name), png)
+    console.log(`${name}: ${png.length} bytes`)
+  }
+}
+
+main()
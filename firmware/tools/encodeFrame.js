@@ -0,0 +1,151 @@
+import fs from "fs"
+import { fileURLToPath } from "url"
+import Jimp from "jimp"
+
+// Packed frame format (see firmware/main/packed_frame.hpp):
+// 20 byte little-endian header + PackBits compressed 4bpp pixels (left pixel in high nibble)
+const MAGIC = "EPFR"
+const VERSION = 1
+const BPP = 4
+const COMPRESSION_RLE = 1
+
+export const Kind = {
+  FULL: 0,
+  KEYFRAME: 1,
+  XOR_DELTA: 2,
+}
+
+// FNV-1a, same as firmware/main/frame_hash.hpp
+export const frameHash = (packed) => {
+  let hash = 2166136261
+  for (const byte of packed) hash = Math.imul(hash ^ byte, 16777619) >>> 0
+  return hash
+}
+
+export const packNibbles = (gray, width, height) => {
+  if (width % 2 !== 0) throw new Error("Frame width must be even")
+
+  const packed = Buffer.alloc((width * height) / 2)
+  for (let i = 0; i < packed.length; i++) {
+    packed[i] = (gray[i * 2] & 0xf0) | (gray[i * 2 + 1] >> 4)
+  }
+  return packed
+}
+
+export const packBits = (data) => {
+  const out = []
+  let i = 0
+
+  while (i < data.length) {
+    let run = 1
+    while (i + run < data.length && run < 128 && data[i + run] === data[i]) run++
+
+    if (run >= 2) {
+      out.push((1 - run) & 0xff, data[i])
+      i += run
+      continue
+    }
+
+    // literal run lasts until next repeat of at least 3 bytes (a 2 byte repeat doesn't pay off inside literal)
+    let literalEnd = i + 1
+    while (
+      literalEnd < data.length &&
+      literalEnd - i < 128 &&
+      !(data[literalEnd] === data[literalEnd + 1] && data[literalEnd] === data[literalEnd + 2])
+    ) {
+      literalEnd++
+    }
+
+    out.push(literalEnd - i - 1)
+    for (let j = i; j < literalEnd; j++) out.push(data[j])
+    i = literalEnd
+  }
+
+  return Buffer.from(out)
+}
+
+export const encodeHeader = ({ x, y, width, height, kind = Kind.FULL, baseHash = 0 }) => {
+  const header = Buffer.alloc(20)
+  header.write(MAGIC, 0, "ascii")
+  header.writeUInt8(VERSION, 4)
+  header.writeUInt8(BPP, 5)
+  header.writeUInt8(COMPRESSION_RLE, 6)
+  header.writeUInt8(kind, 7)
+  header.writeUInt16LE(x, 8)
+  header.writeUInt16LE(y, 10)
+  header.writeUInt16LE(width, 12)
+  header.writeUInt16LE(height, 14)
+  header.writeUInt32LE(baseHash, 16)
+  return header
+}
+
+// gray: one byte per pixel
+export const encodePackedFrame = (gray, width, height, x = 0, y = 0) => {
+  const packed = packNibbles(gray, width, height)
+  return Buffer.concat([encodeHeader({ x, y, width, height }), packBits(packed)])
+}
+
+// keyframe is stored by device as a base for following delta frames
+export const encodeKeyframe = (gray, width, height, x = 0, y = 0) => {
+  const packed = packNibbles(gray, width, height)
+  const header = encodeHeader({ x, y, width, height, kind: Kind.KEYFRAME, baseHash: frameHash(packed) })
+  return Buffer.concat([header, packBits(packed)])
+}
+
+// unchanged areas XOR to zero bytes which PackBits compresses into long repeats
+export const encodeDeltaFrame = (gray, baseGray, width, height, x = 0, y = 0) => {
+  const packed = packNibbles(gray, width, height)
+  const base = packNibbles(baseGray, width, height)
+  for (let i = 0; i < packed.length; i++) packed[i] ^= base[i]
+
+  const header = encodeHeader({ x, y, width, height, kind: Kind.XOR_DELTA, baseHash: frameHash(base) })
+  return Buffer.concat([header, packBits(packed)])
+}
+
+const readGray = async (imageBuffer) => {
+  const img = await Jimp.read(imageBuffer)
+  img.greyscale()
+
+  const { width, height, data } = img.bitmap
+  const gray = Buffer.alloc(width * height)
+  for (let i = 0; i < gray.length; i++) gray[i] = data[i * 4] // RGBA, R = G = B after greyscale
+
+  return { gray, width, height }
+}
+
+export const encodeImage = async (imageBuffer, x = 0, y = 0, { keyframe = false, baseImageBuffer } = {}) => {
+  const { gray, width, height } = await readGray(imageBuffer)
+
+  if (baseImageBuffer) {
+    const base = await readGray(baseImageBuffer)
+    if (base.width !== width || base.height !== height) throw new Error("Base image dimension differs")
+    return encodeDeltaFrame(gray, base.gray, width, height, x, y)
+  }
+  if (keyframe) return encodeKeyframe(gray, width, height, x, y)
+
+  return encodePackedFrame(gray, width, height, x, y)
+}
+
+const main = async () => {
+  const args = process.argv.slice(2)
+  const keyframe = args.includes("--keyframe")
+  const baseIndex = args.indexOf("--base")
+  const baseImage = baseIndex >= 0 ? args[baseIndex + 1] : undefined
+  const positional = args.filter((arg, i) => !arg.startsWith("--") && (baseIndex < 0 || i !== baseIndex + 1))
+
+  const [input, output, x = "0", y = "0"] = positional
+  if (!input || !output) {
+    console.log("Usage: node encodeFrame.js [--keyframe | --base <base image>] <input image> <output frame> [x] [y]")
+    process.exit(1)
+  }
+
+  const frame = await encodeImage(fs.readFileSync(input), parseInt(x), parseInt(y), {
+    keyframe,
+    baseImageBuffer: baseImage ? fs.readFileSync(baseImage) : undefined,
+  })
+  fs.writeFileSync(output, frame)
+
+  console.log(`Packed frame ${frame.byteLength / 1024} kB written to '${output}'`)
+}
+
+if (process.argv[1] === fileURLToPath(import.meta.url)) main()
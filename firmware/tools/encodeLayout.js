@@ -0,0 +1,149 @@
+import fs from "fs"
+import { fileURLToPath } from "url"
+
+// Layout format (see firmware/main/layout.hpp):
+// 14 byte little-endian header + drawing commands rendered by the device with its fonts and icons
+const MAGIC = "EPLY"
+const VERSION = 1
+
+const Command = {
+  BOX: 0x01,
+  TEXT: 0x02,
+  ICON: 0x03,
+  SPARKLINE: 0x04,
+}
+
+export const Align = { left: 0, center: 1, right: 2 }
+
+export const Font = { lato20: 0 }
+
+// battery0 .. battery10, wifi0 .. wifi4 are indexed by level
+export const Icon = {
+  ...Object.fromEntries(Array.from({ length: 11 }, (_, i) => [`battery${i}`, i])),
+  ...Object.fromEntries(Array.from({ length: 5 }, (_, i) => [`wifi${i}`, 11 + i])),
+  stale: 16,
+  error: 17,
+  sun: 32,
+  cloud: 33,
+  rain: 34,
+  snow: 35,
+  storm: 36,
+}
+
+const NO_FILL = 0xff
+
+const checkLevel = (level, what) => {
+  if (!Number.isInteger(level) || level < 0 || level > 15) throw new Error(`${what} level must be 0 - 15`)
+  return level
+}
+
+// samples are scaled from min .. max of values (or given range) to 0 .. 255
+export const toSamples = (values, min = Math.min(...values), max = Math.max(...values)) =>
+  values.map((value) => {
+    if (max <= min) return 128
+    return Math.round(((Math.min(Math.max(value, min), max) - min) / (max - min)) * 255)
+  })
+
+const encodeBox = ({ x, y, width, height, fill, border = 0, borderWidth = 0 }) => {
+  const command = Buffer.alloc(12)
+  command.writeUInt8(Command.BOX, 0)
+  command.writeInt16LE(x, 1)
+  command.writeInt16LE(y, 3)
+  command.writeUInt16LE(width, 5)
+  command.writeUInt16LE(height, 7)
+  command.writeUInt8(fill === undefined ? NO_FILL : checkLevel(fill, "Box fill"), 9)
+  command.writeUInt8(checkLevel(border, "Box border"), 10)
+  command.writeUInt8(borderWidth, 11)
+  return command
+}
+
+const encodeText = ({ x, y, text, font = "lato20", scale = 1, level = 0, align = "left" }) => {
+  const bytes = Buffer.from(text, "utf8")
+  if (bytes.length > 255) throw new Error(`Text '${text}' is longer than 255 bytes`)
+  if (Font[font] === undefined) throw new Error(`Unknown font '${font}'`)
+  if (Align[align] === undefined) throw new Error(`Unknown align '${align}'`)
+
+  const command = Buffer.alloc(10)
+  command.writeUInt8(Command.TEXT, 0)
+  command.writeInt16LE(x, 1)
+  command.writeInt16LE(y, 3)
+  command.writeUInt8(Font[font], 5)
+  command.writeUInt8(scale, 6)
+  command.writeUInt8(checkLevel(level, "Text"), 7)
+  command.writeUInt8(Align[align], 8)
+  command.writeUInt8(bytes.length, 9)
+  return Buffer.concat([command, bytes])
+}
+
+const encodeIcon = ({ x, y, icon }) => {
+  if (Icon[icon] === undefined) throw new Error(`Unknown icon '${icon}'`)
+
+  const command = Buffer.alloc(6)
+  command.writeUInt8(Command.ICON, 0)
+  command.writeInt16LE(x, 1)
+  command.writeInt16LE(y, 3)
+  command.writeUInt8(Icon[icon], 5)
+  return command
+}
+
+const encodeSparkline = ({ x, y, width, height, values, min, max, level = 0, thickness = 2 }) => {
+  if (values.length === 0 || values.length > 255) throw new Error("Sparkline needs 1 - 255 values")
+
+  const command = Buffer.alloc(12)
+  command.writeUInt8(Command.SPARKLINE, 0)
+  command.writeInt16LE(x, 1)
+  command.writeInt16LE(y, 3)
+  command.writeUInt16LE(width, 5)
+  command.writeUInt16LE(height, 7)
+  command.writeUInt8(checkLevel(level, "Sparkline"), 9)
+  command.writeUInt8(thickness, 10)
+  command.writeUInt8(values.length, 11)
+  return Buffer.concat([command, Buffer.from(toSamples(values, min, max))])
+}
+
+const encoders = {
+  box: encodeBox,
+  text: encodeText,
+  icon: encodeIcon,
+  sparkline: encodeSparkline,
+}
+
+// layout: { x, y, width, height, background, elements: [{ type: "box" | "text" | "icon" | "sparkline", ... }] }
+// x and width have to be multiples of 4, element coordinates are relative to the layout
+export const encodeLayout = ({ x = 0, y = 0, width = 1200, height = 825, background = 15, elements = [] }) => {
+  if (x % 4 !== 0 || width % 4 !== 0) throw new Error("Layout x and width must be multiples of 4")
+
+  const header = Buffer.alloc(14)
+  header.write(MAGIC, 0, "ascii")
+  header.writeUInt8(VERSION, 4)
+  header.writeUInt8(checkLevel(background, "Background"), 5)
+  header.writeUInt16LE(x, 6)
+  header.writeUInt16LE(y, 8)
+  header.writeUInt16LE(width, 10)
+  header.writeUInt16LE(height, 12)
+
+  const commands = elements.map((element) => {
+    const encode = encoders[element.type]
+    if (!encode) throw new Error(`Unknown layout element '${element.type}'`)
+    if (element.width > width || element.height > height) {
+      throw new Error(`Layout ${element.type} must not be larger than the layout`)
+    }
+    return encode(element)
+  })
+  return Buffer.concat([header, ...commands])
+}
+
+const main = () => {
+  const [input, output] = process.argv.slice(2)
+  if (!input || !output) {
+    console.log("Usage: node encodeLayout.js <layout.json> <output layout>")
+    process.exit(1)
+  }
+
+  const layout = encodeLayout(JSON.parse(fs.readFileSync(input, "utf8")))
+  fs.writeFileSync(output, layout)
+
+  console.log(`Layout ${layout.byteLength} B written to '${output}'`)
+}
+
+if (process.argv[1] === fileURLToPath(import.meta.url)) main()
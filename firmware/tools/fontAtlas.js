@@ -0,0 +1,130 @@
+import fs from "fs"
+import path from "path"
+import { fileURLToPath } from "url"
+import Jimp from "jimp"
+
+// Converts BMFont (AngelCode text .fnt with PNG pages, eg. from Hiero or bmfont) into 4bpp glyph atlas header
+// for firmware/main/font.hpp. Glyph coverage is taken from page alpha, or from luminance of opaque pages.
+export const DEFAULT_CHARS =
+  " !\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~°"
+
+const parseLine = (line) => {
+  const [tag] = line.trim().split(/\s+/)
+  const attributes = {}
+  for (const match of line.matchAll(/(\w+)=("[^"]*"|\S+)/g)) {
+    const value = match[2]
+    attributes[match[1]] = value.startsWith('"') ? value.slice(1, -1) : Number(value)
+  }
+  return { tag, attributes }
+}
+
+export const parseBmFont = (text) => {
+  const font = { pages: [], chars: new Map() }
+  for (const line of text.split("\n")) {
+    const { tag, attributes } = parseLine(line)
+    if (tag === "common") {
+      font.lineHeight = attributes.lineHeight
+      font.base = attributes.base
+    } else if (tag === "page") {
+      font.pages[attributes.id] = attributes.file
+    } else if (tag === "char") {
+      font.chars.set(attributes.id, attributes)
+    }
+  }
+  return font
+}
+
+const coverageReader = (page) => {
+  const { width, data } = page.bitmap
+  let isOpaque = true
+  for (let i = 3; i < data.length; i += 4) isOpaque = isOpaque && data[i] === 255
+
+  return (x, y) => {
+    const i = (y * width + x) * 4
+    const value = isOpaque ? (data[i] * 299 + data[i + 1] * 587 + data[i + 2] * 114) / 1000 : data[i + 3]
+    return Math.round((value * 15) / 255)
+  }
+}
+
+// returns glyph table and packed atlas, glyph rows start on whole byte
+export const buildAtlas = (font, pages, chars = DEFAULT_CHARS) => {
+  const codepoints = [...new Set([...chars].map((char) => char.codePointAt(0)))].sort((a, b) => a - b)
+  const readers = pages.map(coverageReader)
+
+  const glyphs = []
+  const atlas = []
+  for (const codepoint of codepoints) {
+    const char = font.chars.get(codepoint)
+    if (!char) {
+      console.warn(`Font doesn't contain '${String.fromCodePoint(codepoint)}' (U+${codepoint.toString(16)})`)
+      continue
+    }
+
+    const coverage = readers[char.page]
+    const rowSize = Math.ceil(char.width / 2)
+    glyphs.push({ ...char, codepoint, offset: atlas.length })
+    for (let y = 0; y < char.height; y++) {
+      for (let i = 0; i < rowSize; i++) {
+        const left = coverage(char.x + i * 2, char.y + y)
+        const right = i * 2 + 1 < char.width ? coverage(char.x + i * 2 + 1, char.y + y) : 0
+        atlas.push((left << 4) | right)
+      }
+    }
+  }
+  return { glyphs, atlas: Buffer.from(atlas) }
+}
+
+const hexBytes = (bytes) => {
+  const lines = []
+  for (let i = 0; i < bytes.length; i += 16) {
+    lines.push("  " + [...bytes.subarray(i, i + 16)].map((byte) => `0x${byte.toString(16).padStart(2, "0")},`).join(" "))
+  }
+  return lines.join("\n")
+}
+
+export const toHeader = (name, font, { glyphs, atlas }, source) => {
+  const glyphLines = glyphs.map(
+    (g) =>
+      `  {0x${g.codepoint.toString(16)}, ${g.offset}, ${g.width}, ${g.height}, ${g.xoffset}, ${g.yoffset}, ${g.xadvance}},`
+  )
+  return `#pragma once
+
+#include "font.hpp"
+
+// Generated by firmware/tools/fontAtlas.js from ${source}, do not edit.
+namespace fonts {
+namespace ${name}_data {
+inline constexpr Font::Glyph glyphs[] = {
+${glyphLines.join("\n")}
+};
+
+inline constexpr uint8_t atlas[] = {
+${hexBytes(atlas)}
+};
+} // namespace ${name}_data
+
+inline constexpr Font ${name}{${font.lineHeight},
+  ${font.base},
+  ${name}_data::glyphs,
+  sizeof(${name}_data::glyphs) / sizeof(Font::Glyph),
+  ${name}_data::atlas};
+} // namespace fonts
+`
+}
+
+const main = async () => {
+  const [input, output, name, chars = DEFAULT_CHARS] = process.argv.slice(2)
+  if (!input || !output || !name) {
+    console.log("Usage: node fontAtlas.js <font.fnt> <output.hpp> <font name> [characters]")
+    process.exit(1)
+  }
+
+  const font = parseBmFont(fs.readFileSync(input, "utf8"))
+  const pages = await Promise.all(font.pages.map((page) => Jimp.read(path.join(path.dirname(input), page))))
+  const atlas = buildAtlas(font, pages, chars)
+  fs.writeFileSync(output, toHeader(name, font, atlas, path.basename(input)))
+
+  console.log(`${atlas.glyphs.length} glyphs, ${atlas.atlas.length} B atlas written to '${output}'`)
+}
+
+if (process.argv[1] === fileURLToPath(import.meta.url)) main()
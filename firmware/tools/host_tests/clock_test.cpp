@@ -0,0 +1,96 @@
+// LocalClock minute shown by a wake, network wake schedule and sleep time to the next minute
+
+#include "clock.hpp"
+#include "host_test.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+
+namespace {
+constexpr int64_t minute = LocalClock::minute;
+constexpr int64_t second = 1'000'000;
+// 2026-10-19 12:00:00 UTC
+constexpr int64_t noon = 1'792'411'200;
+
+void testShownMinute() {
+  CHECK(LocalClock::shownMinute(noon) == noon);
+  CHECK(LocalClock::shownMinute(noon + 54) == noon);
+  CHECK(LocalClock::shownMinute(noon + 55) == noon + minute);
+  // early wake shows the coming minute
+  CHECK(LocalClock::shownMinute(noon - 5) == noon);
+  CHECK(LocalClock::shownMinute(noon - 1) == noon);
+  CHECK(LocalClock::shownMinute(noon - 6) == noon - minute);
+}
+
+void testNetworkWake() {
+  LocalClock::State state{};
+  // time isn't known after power on
+  CHECK(LocalClock::isNetworkWakeDue(state, noon, 10));
+
+  state = {noon, 0, 3, true};
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon + minute, 10));
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon + 9 * minute, 10));
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon + 10 * minute - 6, 10));
+  // early wake of the interval minute
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + 10 * minute - 5, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + 10 * minute, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + 60 * minute, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + minute, 1));
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon + 30, 1));
+
+  // time going backwards (RTC reset, SNTP correction)
+  CHECK(LocalClock::isNetworkWakeDue(state, noon - minute, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, 0, 10));
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon - 3, 10));
+
+  // content change announced by the schedule topic
+  state.nextContentTime = noon + 3 * minute;
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon + 2 * minute, 10));
+  CHECK(!LocalClock::isNetworkWakeDue(state, noon + 3 * minute - 6, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + 3 * minute - 5, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + 3 * minute, 10));
+  CHECK(LocalClock::isNetworkWakeDue(state, noon + 5 * minute, 10));
+}
+
+void testSleepTime() {
+  const int64_t noonUs = noon * second;
+  CHECK(LocalClock::sleepTime(noonUs) == minute * second);
+  CHECK(LocalClock::sleepTime(noonUs + 1) == minute * second - 1);
+  CHECK(LocalClock::sleepTime(noonUs + 30 * second) == 30 * second);
+  // the next minute is too close to wake up for it
+  CHECK(LocalClock::sleepTime(noonUs + 55 * second - 1) == 5 * second + 1);
+  CHECK(LocalClock::sleepTime(noonUs + 55 * second) == 5 * second);
+  CHECK(LocalClock::sleepTime(noonUs + 55 * second + 1) == minute * second + 5 * second - 1);
+  CHECK(LocalClock::sleepTime(noonUs + minute * second - 1) == minute * second + 1);
+}
+
+void testParsePlacement() {
+  const auto placement = LocalClock::parsePlacement("1040,16,2");
+  CHECK(placement && placement->x == 1040 && placement->y == 16 && placement->scale == 2);
+  CHECK(LocalClock::parsePlacement("8,0") && LocalClock::parsePlacement("8,0")->scale == 1);
+  CHECK(!LocalClock::parsePlacement(""));
+  CHECK(!LocalClock::parsePlacement("2,0"));
+  CHECK(!LocalClock::parsePlacement("8,0,0"));
+  CHECK(!LocalClock::parsePlacement("8,0,9"));
+  CHECK(!LocalClock::parsePlacement("8,0,1,"));
+  CHECK(!LocalClock::parsePlacement("65536,0"));
+}
+
+void testFormat() {
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  CHECK(LocalClock::format(noon) == "12:00");
+  CHECK(LocalClock::format(LocalClock::shownMinute(noon - 3)) == "12:00");
+  CHECK(LocalClock::format(noon - 6) == "11:59");
+}
+} // namespace
+
+int main() {
+  testShownMinute();
+  testNetworkWake();
+  testSleepTime();
+  testParsePlacement();
+  testFormat();
+  return finishTest("clock_test");
+}
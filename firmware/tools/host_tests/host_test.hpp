@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdio>
+
+// failed checks are reported and counted, test fails when there is any
+inline int failedChecks = 0;
+
+#define CHECK(condition) \
+  do { \
+    if (!(condition)) { \
+      std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      failedChecks++; \
+    } \
+  } while (false)
+
+inline int finishTest(const char* name) {
+  std::printf("%s: %s\n", name, failedChecks == 0 ? "passed" : "FAILED");
+  return failedChecks == 0 ? 0 : 1;
+}
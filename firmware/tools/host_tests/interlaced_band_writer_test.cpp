@@ -0,0 +1,315 @@
+// InterlacedBandWriter fed by pngle compared with the raster of Adam7 interlaced PNG of random size. The PNG is cut
+// after every pass and at random offsets, preview flushed there (as when the image won't be finished in time) is
+// checked against blocks of pass pixels drawn so far, then decoding continues to the full image.
+//
+// NOTE pngle draws inflated rows when its 32 kB dictionary is full (usually in the middle of a row), so previews of
+// small images are empty
+
+#include "host_test.hpp"
+#include "interlaced_band_writer.hpp"
+#include "pngle/pngle.h"
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr uint8_t initialLevel = 5;
+
+struct Pass {
+  uint32_t x, y; // first pixel
+  uint32_t stepX, stepY;
+  uint32_t blockW, blockH; // drawn block covers pixels of following passes
+};
+
+constexpr std::array<Pass, 7> passes{{
+  {0, 0, 8, 8, 8, 8},
+  {4, 0, 8, 8, 4, 8},
+  {0, 4, 4, 8, 4, 4},
+  {2, 0, 4, 4, 2, 4},
+  {0, 2, 2, 4, 2, 2},
+  {1, 0, 2, 2, 1, 2},
+  {0, 1, 1, 2, 1, 1},
+}};
+
+struct Image {
+  uint32_t width;
+  uint32_t height;
+  std::vector<uint8_t> gray;
+
+  uint8_t level(uint32_t x, uint32_t y) const {
+    return gray[y * width + x] >> 4;
+  }
+};
+
+uint32_t passColumns(const Image& image, const Pass& pass) {
+  return image.width > pass.x ? (image.width - pass.x + pass.stepX - 1) / pass.stepX : 0;
+}
+
+uint32_t passRows(const Image& image, const Pass& pass) {
+  return image.height > pass.y ? (image.height - pass.y + pass.stepY - 1) / pass.stepY : 0;
+}
+
+uint32_t passPixels(const Image& image, const Pass& pass) {
+  return passColumns(image, pass) * passRows(image, pass);
+}
+
+// display levels after the first pixelCount pass pixels are drawn
+std::vector<uint8_t> preview(const Image& image, uint32_t pixelCount) {
+  std::vector<uint8_t> levels(image.width * image.height, initialLevel);
+  for (const Pass& pass : passes) {
+    for (uint32_t y = pass.y; y < image.height; y += pass.stepY) {
+      for (uint32_t x = pass.x; x < image.width && pixelCount > 0; x += pass.stepX, pixelCount--) {
+        for (uint32_t by = y; by < std::min(y + pass.blockH, image.height); by++) {
+          for (uint32_t bx = x; bx < std::min(x + pass.blockW, image.width); bx++) {
+            levels[by * image.width + bx] = image.level(x, y);
+          }
+        }
+      }
+    }
+  }
+  return levels;
+}
+
+// 8 bit gray Adam7 PNG, zlib stream of stored blocks split to IDAT chunk per (non-empty) pass
+class PngWriter {
+  std::vector<uint8_t> _png{137, 80, 78, 71, 13, 10, 26, 10};
+
+public:
+  // end offset of IDAT chunk of every pass (the same as the previous one for empty pass)
+  std::array<std::size_t, passes.size()> passEnds{};
+
+  explicit PngWriter(const Image& image) {
+    std::vector<uint8_t> header;
+    appendBigEndian(header, image.width);
+    appendBigEndian(header, image.height);
+    header.insert(header.end(), {8, 0, 0, 0, 1}); // depth, gray, deflate, adaptive filter, Adam7
+    appendChunk("IHDR", header);
+
+    std::size_t lastPass = 0;
+    for (std::size_t p = 0; p < passes.size(); p++) {
+      if (passColumns(image, passes[p]) > 0 && passRows(image, passes[p]) > 0) lastPass = p;
+    }
+
+    uint32_t adler = 1;
+    std::size_t end = _png.size();
+    for (std::size_t p = 0; p < passes.size(); p++) {
+      const Pass& pass = passes[p];
+      const uint32_t columns = passColumns(image, pass);
+      const uint32_t rows = passRows(image, pass);
+      passEnds[p] = end;
+      if (columns == 0 || rows == 0) continue; // no filter bytes in empty pass
+
+      std::vector<uint8_t> raw;
+      for (uint32_t row = 0; row < rows; row++) {
+        raw.push_back(0); // filter type none
+        for (uint32_t column = 0; column < columns; column++) {
+          raw.push_back(image.gray[(pass.y + row * pass.stepY) * image.width + pass.x + column * pass.stepX]);
+        }
+      }
+      adler = adler32(adler, raw);
+
+      std::vector<uint8_t> data;
+      if (p == 0) data.insert(data.end(), {0x78, 0x01});
+      for (std::size_t offset = 0; offset < raw.size(); offset += UINT16_MAX) {
+        const std::size_t size = std::min<std::size_t>(raw.size() - offset, UINT16_MAX);
+        const bool isFinal = p == lastPass && offset + size == raw.size();
+        data.insert(data.end(), {isFinal, uint8_t(size), uint8_t(size >> 8), uint8_t(~size), uint8_t(~size >> 8)});
+        data.insert(data.end(), raw.begin() + offset, raw.begin() + offset + size);
+      }
+      if (p == lastPass) appendBigEndian(data, adler);
+
+      appendChunk("IDAT", data);
+      end = passEnds[p] = _png.size();
+    }
+    appendChunk("IEND", {});
+  }
+
+  const std::vector<uint8_t>& png() const {
+    return _png;
+  }
+
+private:
+  static void appendBigEndian(std::vector<uint8_t>& data, uint32_t value) {
+    data.insert(data.end(), {uint8_t(value >> 24), uint8_t(value >> 16), uint8_t(value >> 8), uint8_t(value)});
+  }
+
+  static uint32_t crc32(const uint8_t* data, std::size_t size) {
+    uint32_t crc = 0xffffffff;
+    for (std::size_t i = 0; i < size; i++) {
+      crc ^= data[i];
+      for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+    return ~crc;
+  }
+
+  static uint32_t adler32(uint32_t adler, const std::vector<uint8_t>& data) {
+    uint32_t a = adler & 0xffff, b = adler >> 16;
+    for (uint8_t byte : data) {
+      a = (a + byte) % 65521;
+      b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+  }
+
+  void appendChunk(const char* type, const std::vector<uint8_t>& data) {
+    appendBigEndian(_png, data.size());
+    const std::size_t typeOffset = _png.size();
+    _png.insert(_png.end(), type, type + 4);
+    _png.insert(_png.end(), data.begin(), data.end());
+    appendBigEndian(_png, crc32(_png.data() + typeOffset, _png.size() - typeOffset));
+  }
+};
+
+// pngle -> InterlacedBandWriter -> display levels, packed rows are loaded from and written to them as on the device
+class Decoder {
+  const Image& _image;
+  std::vector<uint8_t> _buffer;
+  InterlacedBandWriter _writer{_buffer.data(),
+    _buffer.size(),
+    [this](uint16_t y, uint8_t* row) { loadRow(y, row); },
+    [this](uint16_t y, uint16_t height, const uint8_t* band) { writeBand(y, height, band); }};
+  pngle_t* _pngle{};
+  std::size_t _fed{};
+
+public:
+  std::vector<uint8_t> levels;
+  bool isDone{};
+  uint32_t drawnPixels{};
+
+  Decoder(const Image& image, std::size_t bufferRows) :
+    _image{image},
+    _buffer((image.width + 1) / 2 * bufferRows),
+    levels(image.width * image.height, initialLevel) {
+    _pngle = pngle_new();
+    pngle_set_user_data(_pngle, this);
+    pngle_set_init_callback(_pngle, [](pngle_t* pngle, uint32_t w, uint32_t) {
+      static_cast<Decoder*>(pngle_get_user_data(pngle))->_writer.begin(w);
+    });
+    pngle_set_draw_callback(_pngle,
+      [](pngle_t* pngle, uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint8_t rgba[4]) {
+        auto decoder = static_cast<Decoder*>(pngle_get_user_data(pngle));
+        decoder->_writer.draw(x, y, w, h, rgba[0] >> 4);
+        decoder->drawnPixels++;
+      });
+    pngle_set_done_callback(_pngle, [](pngle_t* pngle) {
+      auto decoder = static_cast<Decoder*>(pngle_get_user_data(pngle));
+      decoder->_writer.flush();
+      decoder->isDone = true;
+    });
+  }
+
+  ~Decoder() {
+    pngle_destroy(_pngle);
+  }
+
+  Decoder(const Decoder&) = delete;
+  Decoder& operator=(const Decoder&) = delete;
+
+  // feeds PNG up to end offset, bytes pngle doesn't consume yet are fed by the next call
+  bool feed(const std::vector<uint8_t>& png, std::size_t end) {
+    while (_fed < end) {
+      const int fed = pngle_feed(_pngle, png.data() + _fed, end - _fed);
+      if (fed < 0) {
+        std::fprintf(stderr, "pngle error: %s\n", pngle_error(_pngle));
+        return false;
+      }
+      if (fed == 0) break;
+      _fed += fed;
+    }
+    return true;
+  }
+
+  void flush() {
+    _writer.flush();
+  }
+
+private:
+  void loadRow(uint16_t y, uint8_t* row) {
+    for (uint32_t x = 0; x < _image.width; x += 2) {
+      const uint8_t right = x + 1 < _image.width ? levels[y * _image.width + x + 1] : 0;
+      row[x / 2] = (levels[y * _image.width + x] << 4) | right;
+    }
+  }
+
+  void writeBand(uint16_t y, uint16_t height, const uint8_t* band) {
+    const uint32_t rowSize = (_image.width + 1) / 2;
+    for (uint32_t row = 0; row < height; row++) {
+      CHECK(y + row < _image.height);
+      if (y + row >= _image.height) return;
+      for (uint32_t x = 0; x < _image.width; x++) {
+        const uint8_t byte = band[row * rowSize + x / 2];
+        levels[(y + row) * _image.width + x] = x % 2 == 0 ? byte >> 4 : byte & 0x0f;
+      }
+    }
+  }
+};
+
+// passes which had a preview flushed in the middle of them
+std::array<bool, passes.size()> splitPasses{};
+
+void checkPreview(const Image& image, const std::vector<uint8_t>& png, std::size_t bufferRows, std::size_t cut) {
+  Decoder decoder{image, bufferRows};
+  CHECK(decoder.feed(png, cut));
+  decoder.flush();
+  CHECK(decoder.levels == preview(image, decoder.drawnPixels));
+
+  uint32_t passStart = 0;
+  for (std::size_t p = 0; p < passes.size(); p++) {
+    const uint32_t passEnd = passStart + passPixels(image, passes[p]);
+    if (decoder.drawnPixels > passStart && decoder.drawnPixels < passEnd) splitPasses[p] = true;
+    passStart = passEnd;
+  }
+
+  CHECK(decoder.feed(png, png.size()));
+  CHECK(decoder.isDone && decoder.levels == preview(image, UINT32_MAX));
+}
+
+void testImage(const Image& image, std::size_t bufferRows, int randomCuts, std::mt19937& random) {
+  const PngWriter writer{image};
+  const std::vector<uint8_t>& png = writer.png();
+
+  {
+    Decoder decoder{image, bufferRows};
+    CHECK(decoder.feed(png, png.size()));
+    CHECK(decoder.isDone);
+    CHECK(decoder.levels == preview(image, UINT32_MAX));
+  }
+
+  for (std::size_t cut : writer.passEnds) checkPreview(image, png, bufferRows, cut);
+  std::uniform_int_distribution<std::size_t> cut{0, png.size() - 1};
+  for (int i = 0; i < randomCuts; i++) checkPreview(image, png, bufferRows, cut(random));
+}
+} // namespace
+
+int main() {
+  std::mt19937 random{7};
+  std::uniform_int_distribution<uint32_t> smallSize{1, 97};
+  std::uniform_int_distribution<uint32_t> largeSize{150, 500};
+  std::uniform_int_distribution<std::size_t> bufferRows{8, 16};
+  std::uniform_int_distribution<int> gray{0, 255};
+
+  auto randomImage = [&](uint32_t width, uint32_t height) {
+    Image image{width, height, std::vector<uint8_t>(width * height)};
+    for (uint8_t& value : image.gray) value = gray(random);
+    return image;
+  };
+
+  // smallest images have empty passes, odd widths end with half byte
+  for (uint32_t width = 1; width <= 9; width++) {
+    for (uint32_t height = 1; height <= 9; height++) testImage(randomImage(width, height), 8, 2, random);
+  }
+  for (int i = 0; i < 100; i++) {
+    testImage(randomImage(smallSize(random), smallSize(random)), bufferRows(random), 2, random);
+  }
+  // more than 32 kB of pass rows, previews are drawn
+  for (int i = 0; i < 10; i++) {
+    testImage(randomImage(largeSize(random), largeSize(random)), bufferRows(random), 5, random);
+  }
+  // dictionary is full in the middle of every pass, including the first one
+  testImage(randomImage(1800, 1200), 8, 0, random);
+  for (std::size_t p = 0; p < passes.size(); p++) CHECK(splitPasses[p]);
+
+  return finishTest("interlaced_band_writer_test");
+}
@@ -0,0 +1,212 @@
+// Layout parsing of malformed messages from the network (truncated commands, extreme sizes) and rendering of what
+// gets parsed into strips, which must stay inside the strip and the sparkline samples
+
+#include "host_test.hpp"
+#include "layout.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+constexpr uint16_t maxU16 = UINT16_MAX;
+
+// little-endian layout message
+class Message {
+  std::vector<uint8_t> _data{Layout::magic.begin(), Layout::magic.end()};
+
+public:
+  Message(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t background = 15) {
+    u8(Layout::version).u8(background).u16(x).u16(y).u16(width).u16(height);
+  }
+
+  Message& u8(uint8_t value) {
+    _data.push_back(value);
+    return *this;
+  }
+
+  Message& u16(uint16_t value) {
+    return u8(value & 0xff).u8(value >> 8);
+  }
+
+  Message& box(int16_t x, int16_t y, uint16_t width, uint16_t height, uint8_t fill, uint8_t border = 0,
+    uint8_t borderWidth = 0) {
+    return u8(0x01).u16(x).u16(y).u16(width).u16(height).u8(fill).u8(border).u8(borderWidth);
+  }
+
+  Message& text(int16_t x, int16_t y, const char* text) {
+    u8(0x02).u16(x).u16(y).u8(0).u8(1).u8(0).u8(0).u8(std::strlen(text));
+    for (const char* c = text; *c != '\0'; c++) u8(*c);
+    return *this;
+  }
+
+  Message& icon(int16_t x, int16_t y, uint8_t id) {
+    return u8(0x03).u16(x).u16(y).u8(id);
+  }
+
+  Message& sparkline(int16_t x, int16_t y, uint16_t width, uint16_t height, const std::vector<uint8_t>& samples,
+    uint8_t thickness = 1) {
+    u8(0x04).u16(x).u16(y).u16(width).u16(height).u8(0).u8(thickness).u8(samples.size());
+    for (uint8_t sample : samples) u8(sample);
+    return *this;
+  }
+
+  const std::vector<uint8_t>& data() const {
+    return _data;
+  }
+};
+
+// packed 4bpp strip with guard bytes around it, which rendering must not touch
+class Strip {
+  static constexpr std::size_t guardSize = 64;
+  static constexpr uint8_t guard = 0xa5;
+  std::vector<uint8_t> _bytes;
+
+public:
+  const uint32_t x, y, width, height;
+
+  Strip(uint32_t x, uint32_t y, uint32_t width, uint32_t height) :
+    _bytes(guardSize + width / 2 * height + guardSize, guard), x{x}, y{y}, width{width}, height{height} {}
+
+  void render(const Layout& layout) {
+    layout.render(_bytes.data() + guardSize, x, y, width, height);
+  }
+
+  uint8_t level(uint32_t displayX, uint32_t displayY) const {
+    const uint8_t byte = _bytes[guardSize + (displayY - y) * (width / 2) + (displayX - x) / 2];
+    return (displayX - x) % 2 == 0 ? byte >> 4 : byte & 0x0f;
+  }
+
+  bool hasGuards() const {
+    for (std::size_t i = 0; i < guardSize; i++) {
+      if (_bytes[i] != guard || _bytes[_bytes.size() - 1 - i] != guard) return false;
+    }
+    return true;
+  }
+};
+
+bool parse(Layout& layout, const Message& message, std::size_t size = SIZE_MAX) {
+  return layout.parse(message.data().data(), std::min(size, message.data().size()));
+}
+
+void testValid() {
+  const Message message = Message(100, 200, 400, 100, 15)
+                            .box(10, 10, 20, 10, 0)
+                            .text(50, 10, "Ok")
+                            .icon(100, 10, 32)
+                            .sparkline(200, 0, 100, 50, {0, 255});
+  Layout layout;
+  CHECK(parse(layout, message));
+  CHECK(layout.x() == 100 && layout.y() == 200 && layout.width() == 400 && layout.height() == 100);
+
+  Strip strip{100, 200, 400, 100};
+  strip.render(layout);
+  CHECK(strip.hasGuards());
+  CHECK(strip.level(100, 200) == 15); // background
+  CHECK(strip.level(110, 210) == 0 && strip.level(129, 219) == 0); // box
+  CHECK(strip.level(130, 210) == 15 && strip.level(110, 220) == 15);
+  // sparkline from the bottom left to the top right
+  CHECK(strip.level(300, 249) == 0 && strip.level(300, 200) == 15);
+  CHECK(strip.level(399, 200) == 0 && strip.level(399, 249) == 15);
+}
+
+// every prefix of the message cut inside a command fails, the layout doesn't keep elements parsed before
+void testTruncated() {
+  const Message message = Message(0, 0, 400, 100)
+                            .box(0, 0, 10, 10, 0)
+                            .text(0, 20, "Truncated")
+                            .icon(0, 40, 0)
+                            .sparkline(0, 60, 100, 20, {1, 2, 3, 4, 5});
+  // ends of the header and commands
+  const std::vector<std::size_t> ends{14, 26, 45, 51, 68};
+  CHECK(ends.back() == message.data().size());
+
+  Layout layout;
+  for (std::size_t size = 0; size <= message.data().size(); size++) {
+    const bool isEnd = std::find(ends.begin(), ends.end(), size) != ends.end();
+    CHECK(parse(layout, message, size) == isEnd);
+    if (!isEnd) {
+      // layout of the previous message isn't rendered
+      Strip strip{0, 0, 400, 1};
+      strip.render(layout);
+      CHECK(strip.hasGuards());
+    }
+  }
+
+  CHECK(!parse(layout, Message(0, 0, 400, 100).u8(0x01).u16(0)));
+  CHECK(std::strcmp(layout.error(), "Truncated box") == 0);
+  CHECK(!parse(layout, Message(0, 0, 400, 100).text(0, 0, "Text"), 14 + 10 + 3));
+  CHECK(std::strcmp(layout.error(), "Truncated text") == 0);
+  CHECK(!parse(layout, Message(0, 0, 400, 100).u8(0x03).u16(0).u16(0)));
+  CHECK(std::strcmp(layout.error(), "Truncated icon") == 0);
+  CHECK(!parse(layout, Message(0, 0, 400, 100).sparkline(0, 0, 10, 10, {1, 2, 3}), 14 + 12 + 2));
+  CHECK(std::strcmp(layout.error(), "Truncated sparkline") == 0);
+  CHECK(!parse(layout, Message(0, 0, 400, 100).u8(0x05)));
+  CHECK(std::strcmp(layout.error(), "Unknown layout command") == 0);
+}
+
+void testExtremeSizes() {
+  Layout layout;
+  // larger than the layout
+  CHECK(!parse(layout, Message(0, 0, 400, 100).box(0, 0, maxU16, 10, 0)));
+  CHECK(!parse(layout, Message(0, 0, 400, 100).box(0, 0, 10, 101, 0)));
+  CHECK(!parse(layout, Message(0, 0, 400, 100).sparkline(0, 0, maxU16, 10, std::vector<uint8_t>(255, 0))));
+  CHECK(!parse(layout, Message(0, 0, 400, 100).sparkline(0, 0, 10, maxU16, {0, 255})));
+  CHECK(std::strcmp(layout.error(), "Sparkline larger than layout") == 0);
+
+  // as large as the largest layout, at extreme offsets, rendered into a strip at its right bottom corner
+  const std::vector<uint8_t> samples(255, 255);
+  const Message message = Message(maxU16, maxU16, maxU16, maxU16, 0)
+                            .box(INT16_MIN, INT16_MIN, maxU16, maxU16, 15, 15, 255)
+                            .box(INT16_MAX, INT16_MAX, maxU16, maxU16, 15)
+                            .sparkline(0, 0, maxU16, maxU16, samples, 255)
+                            .sparkline(INT16_MIN, INT16_MAX, maxU16, 1, samples)
+                            .text(INT16_MAX, INT16_MIN, "Extreme")
+                            .icon(INT16_MAX, INT16_MAX, 36);
+  CHECK(parse(layout, message));
+  for (uint32_t offset : {0u, 65536u, 2u * maxU16 - 8}) {
+    Strip strip{offset, offset, 256, 8};
+    strip.render(layout);
+    CHECK(strip.hasGuards());
+  }
+
+  // every column of the widest sparkline is drawn from a sample of the line
+  const Message sparkline = Message(0, 0, maxU16, 1).sparkline(0, 0, maxU16, 1, samples);
+  CHECK(parse(layout, sparkline));
+  Strip right{maxU16 - 255, 0, 256, 1};
+  right.render(layout);
+  CHECK(right.hasGuards());
+  CHECK(right.level(maxU16 - 255, 0) == 0 && right.level(maxU16 - 1, 0) == 0);
+}
+
+// random commands after a valid header either fail or render inside the strip
+void testRandom() {
+  std::mt19937 random{46};
+  Layout layout;
+  for (int n = 0; n < 20000; n++) {
+    const uint16_t width = random() % 2 == 0 ? 1 + random() % 400 : random();
+    Message message(random() % 1200, random() % 825, width & ~3u, random());
+    const std::size_t size = random() % 64;
+    for (std::size_t i = 0; i < size; i++) {
+      // mostly valid command bytes and levels
+      message.u8(random() % 2 == 0 ? 1 + random() % 4 : random() % 16);
+    }
+    if (!parse(layout, message)) continue;
+
+    const uint32_t y = layout.y() + random() % 100;
+    Strip strip{layout.x(), y, std::min<uint32_t>(layout.width(), 400), 4};
+    strip.render(layout);
+    CHECK(strip.hasGuards());
+  }
+}
+} // namespace
+
+int main() {
+  testValid();
+  testTruncated();
+  testExtremeSizes();
+  testRandom();
+  return finishTest("layout_test");
+}
@@ -0,0 +1,106 @@
+// ShownStrips holding back upload of strips which are the same as the shown image
+
+#include "host_test.hpp"
+#include "shown_strips.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+constexpr uint16_t width = 1200;
+constexpr uint16_t stripHeight = 50;
+constexpr std::size_t fullScreenStrips = 17;
+
+// shown state and image as strips, one of them (or none) differs from the others
+class Display {
+  ShownStrips _shownStrips{};
+  ShownStrips::State _state{};
+  std::vector<uint8_t> _strip = std::vector<uint8_t>(width / 2 * stripHeight, 0x11);
+
+public:
+  // returns which strips are uploaded, the state is kept as when the image was shown
+  std::vector<bool> show(std::size_t stripCount, std::size_t changedStrip = SIZE_MAX) {
+    _shownStrips.begin(_state);
+    std::vector<bool> uploaded;
+    for (std::size_t i = 0; i < stripCount; i++) {
+      std::vector<uint8_t> strip = _strip;
+      if (i == changedStrip) strip[5] = 0x99;
+      uploaded.push_back(_shownStrips.submit(0, i * stripHeight, width, stripHeight, strip.data()));
+    }
+    _state = _shownStrips.state();
+    return uploaded;
+  }
+
+  const ShownStrips& shownStrips() const {
+    return _shownStrips;
+  }
+};
+
+// strips from the first one are uploaded
+bool isUploadedFrom(const std::vector<bool>& uploaded, std::size_t first) {
+  for (std::size_t i = 0; i < uploaded.size(); i++) {
+    if (uploaded[i] != (i >= first)) return false;
+  }
+  return true;
+}
+
+void testFullScreen() {
+  Display display;
+  // nothing is known after power on
+  CHECK(isUploadedFrom(display.show(fullScreenStrips), 0));
+  CHECK(!display.shownStrips().isUnchanged());
+  CHECK(display.shownStrips().changedTop() == 0);
+  CHECK(display.shownStrips().changedBottom() == fullScreenStrips * stripHeight);
+
+  CHECK(isUploadedFrom(display.show(fullScreenStrips), fullScreenStrips));
+  CHECK(display.shownStrips().isUnchanged());
+
+  // display memory is valid from the first changed strip on, so all following strips are uploaded
+  CHECK(isUploadedFrom(display.show(fullScreenStrips, 5), 5));
+  CHECK(!display.shownStrips().isUnchanged());
+  CHECK(display.shownStrips().changedTop() == 5 * stripHeight);
+  CHECK(display.shownStrips().changedBottom() == 6 * stripHeight);
+
+  // change back
+  CHECK(isUploadedFrom(display.show(fullScreenStrips), 5));
+  CHECK(display.shownStrips().changedTop() == 5 * stripHeight);
+  CHECK(display.shownStrips().changedBottom() == 6 * stripHeight);
+
+  CHECK(isUploadedFrom(display.show(fullScreenStrips, fullScreenStrips - 1), fullScreenStrips - 1));
+  CHECK(display.shownStrips().changedTop() == (fullScreenStrips - 1) * stripHeight);
+  CHECK(display.shownStrips().changedBottom() == fullScreenStrips * stripHeight);
+}
+
+void testTooManyStrips() {
+  constexpr std::size_t stripCount = 30;
+  Display display;
+  display.show(fullScreenStrips);
+  // strips added after the shown ones
+  CHECK(isUploadedFrom(display.show(stripCount), fullScreenStrips));
+  CHECK(display.shownStrips().changedTop() == fullScreenStrips * stripHeight);
+  CHECK(display.shownStrips().changedBottom() == stripCount * stripHeight);
+  CHECK(display.shownStrips().state().stripCount == ShownStrips::maxStrips);
+
+  // hashes of strips over the limit aren't kept
+  CHECK(isUploadedFrom(display.show(stripCount), ShownStrips::maxStrips));
+  CHECK(display.shownStrips().changedTop() == ShownStrips::maxStrips * stripHeight);
+}
+
+void testDisabled() {
+  ShownStrips shownStrips;
+  shownStrips.begin({});
+  shownStrips.disable();
+  const std::vector<uint8_t> strip(width / 2 * stripHeight);
+  CHECK(shownStrips.submit(0, 0, width, stripHeight, strip.data()));
+  CHECK(!shownStrips.isEnabled());
+  CHECK(!shownStrips.isUnchanged());
+  CHECK(shownStrips.state().stripCount == 0);
+}
+} // namespace
+
+int main() {
+  testFullScreen();
+  testTooManyStrips();
+  testDisabled();
+  return finishTest("shown_strips_test");
+}
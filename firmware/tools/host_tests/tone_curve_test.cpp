@@ -0,0 +1,90 @@
+// ToneCurve tables built from gamma with black/white points and from 16 point curve
+
+#include "host_test.hpp"
+#include "tone_curve.hpp"
+
+#include <cstdint>
+
+namespace {
+bool isNonDecreasing(const ToneCurve::Table& table) {
+  for (std::size_t i = 1; i < table.size(); i++) {
+    if (table[i] < table[i - 1]) return false;
+  }
+  return true;
+}
+
+void testIdentity() {
+  const auto identity = ToneCurve::identity();
+  for (std::size_t i = 0; i < identity.size(); i++) CHECK(identity[i] == i);
+
+  CHECK(ToneCurve::fromGamma(1.0f, 0, 255) == identity);
+  // invalid parameters leave pixels as they are
+  CHECK(ToneCurve::fromGamma(0.0f, 0, 255) == identity);
+  CHECK(ToneCurve::fromGamma(-1.0f, 0, 255) == identity);
+  CHECK(ToneCurve::fromGamma(1.0f, 200, 100) == identity);
+  CHECK(ToneCurve::fromGamma(1.0f, 128, 128) == identity);
+}
+
+void testBlackAndWhitePoints() {
+  const auto table = ToneCurve::fromGamma(1.0f, 16, 240);
+  for (std::size_t i = 0; i <= 16; i++) CHECK(table[i] == 0);
+  for (std::size_t i = 240; i < table.size(); i++) CHECK(table[i] == 255);
+  CHECK(table[128] == 128);
+  CHECK(table[17] > 0 && table[239] < 255);
+  CHECK(isNonDecreasing(table));
+}
+
+void testGammaDirection() {
+  const auto brighter = ToneCurve::fromGamma(2.2f, 0, 255);
+  const auto darker = ToneCurve::fromGamma(0.45f, 0, 255);
+  CHECK(brighter[0] == 0 && brighter[255] == 255);
+  CHECK(darker[0] == 0 && darker[255] == 255);
+  for (std::size_t i = 1; i < 255; i++) {
+    CHECK(brighter[i] >= i);
+    CHECK(darker[i] <= i);
+  }
+  CHECK(brighter[128] > 180);
+  CHECK(darker[128] < 80);
+  CHECK(isNonDecreasing(brighter));
+  CHECK(isNonDecreasing(darker));
+}
+
+void testCurve() {
+  const auto identity = ToneCurve::fromCurve("0,17,34,51,68,85,102,119,136,153,170,187,204,221,238,255");
+  CHECK(identity && *identity == ToneCurve::identity());
+
+  const auto inverted = ToneCurve::fromCurve("255,238,221,204,187,170,153,136,119,102,85,68,51,34,17,0");
+  CHECK(inverted.has_value());
+  if (inverted) {
+    for (std::size_t i = 0; i < inverted->size(); i++) CHECK((*inverted)[i] == 255 - i);
+  }
+
+  // points are hit exactly, values in between are interpolated linearly (rounded)
+  const auto steps = ToneCurve::fromCurve("0,0,0,0,0,0,0,100,200,255,255,255,255,255,255,255");
+  CHECK(steps.has_value());
+  if (steps) {
+    CHECK((*steps)[0] == 0 && (*steps)[102] == 0);
+    CHECK((*steps)[119] == 100 && (*steps)[136] == 200 && (*steps)[153] == 255);
+    CHECK((*steps)[110] == 47); // 8 / 17 of the way from 0 to 100
+    CHECK((*steps)[128] == 153); // 9 / 17 of the way from 100 to 200
+    CHECK((*steps)[255] == 255);
+    CHECK(isNonDecreasing(*steps));
+  }
+
+  CHECK(!ToneCurve::fromCurve(""));
+  CHECK(!ToneCurve::fromCurve("0,1,2"));
+  CHECK(!ToneCurve::fromCurve("0,17,34,51,68,85,102,119,136,153,170,187,204,221,238,256"));
+  CHECK(!ToneCurve::fromCurve("0,17,34,51,68,85,102,119,136,153,170,187,204,221,238,-1"));
+  CHECK(!ToneCurve::fromCurve("0,17,34,51,68,85,102,119,136,153,170,187,204,221,238,255,1"));
+  CHECK(!ToneCurve::fromCurve("0,17,34,51,68,85,102,119,136,153,170,187,204,221,238,255 "));
+  CHECK(!ToneCurve::fromCurve("0;17,34,51,68,85,102,119,136,153,170,187,204,221,238,255"));
+}
+} // namespace
+
+int main() {
+  testIdentity();
+  testBlackAndWhitePoints();
+  testGammaDirection();
+  testCurve();
+  return finishTest("tone_curve_test");
+}
@@ -0,0 +1,40 @@
+// Ancillary PNG chunks understood by the device, inserted right after IHDR:
+// - withTextChunk(png, "dither", "atkinson") selects dithering done by the device
+// - withOffsetChunk(png, x, y) places the image at x, y on the display (x and image width multiple of 4)
+
+const crcTable = Array.from({ length: 256 }, (_, n) => {
+  let c = n
+  for (let k = 0; k < 8; k++) c = c & 1 ? 0xedb88320 ^ (c >>> 1) : c >>> 1
+  return c >>> 0
+})
+
+const crc32 = (buffer) => {
+  let crc = 0xffffffff
+  for (const byte of buffer) crc = crcTable[(crc ^ byte) & 0xff] ^ (crc >>> 8)
+  return (crc ^ 0xffffffff) >>> 0
+}
+
+const PNG_SIGNATURE_LENGTH = 8
+const IHDR_CHUNK_LENGTH = 12 + 13 // length + type + data + crc
+
+const withChunk = (png, type, data) => {
+  const typeAndData = Buffer.concat([Buffer.from(type, "ascii"), data])
+
+  const chunk = Buffer.alloc(12 + data.length)
+  chunk.writeUInt32BE(data.length, 0)
+  typeAndData.copy(chunk, 4)
+  chunk.writeUInt32BE(crc32(typeAndData), 8 + data.length)
+
+  const ihdrEnd = PNG_SIGNATURE_LENGTH + IHDR_CHUNK_LENGTH
+  return Buffer.concat([png.subarray(0, ihdrEnd), chunk, png.subarray(ihdrEnd)])
+}
+
+export const withTextChunk = (png, keyword, text) => withChunk(png, "tEXt", Buffer.from(`${keyword}\0${text}`, "latin1"))
+
+export const withOffsetChunk = (png, x, y) => {
+  const data = Buffer.alloc(9)
+  data.writeInt32BE(x, 0)
+  data.writeInt32BE(y, 4)
+  data.writeUInt8(0, 8) // unit: pixel
+  return withChunk(png, "oFFs", data)
+}
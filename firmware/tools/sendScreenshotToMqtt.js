@@ -2,8 +2,7 @@ import mqtt from "async-mqtt"
 import fs from "fs"
 import captureWebsite from "capture-website"
 import Jimp from "jimp"
-import imagemin from "imagemin"
-import imageminPngquant from "imagemin-pngquant"
+import { withTextChunk } from "./pngChunks.js"
 
 const captureBlackWhiteImage = async (url) => {
   console.log("Capturing website screenshot...")
@@ -23,30 +22,17 @@ const captureBlackWhiteImage = async (url) => {
   console.timeEnd("capture")
 
   const img = await Jimp.read(imageBuffer)
-  img
-    .greyscale()
-    .contrast(0.1)
-    .normalize()
+  // contrast is adjusted on device by tone curve (gamma, black/white points settings)
+  img.greyscale()
 
-  const greyImageBuffer = await img.getBufferAsync(Jimp.MIME_PNG)
-  const minifiedGreyImageBuffer = await imagemin.buffer(
-    greyImageBuffer, {
-      plugins: [
-        imageminPngquant({
-          // TODO play with these params and get feedback from display (look and change, maximize quality)
-          quality: [0.0, 1.0],
-          strip: true,
-          posterize: 4,
-          dithering: false,
-        })
-      ]
-    }
-  )
+  // smooth 8 bit greyscale deflates well, device dithers it down to 16 levels
+  img.colorType(0)
+  const greyImageBuffer = withTextChunk(await img.getBufferAsync(Jimp.MIME_PNG), "dither", "floyd-steinberg")
   console.timeEnd("image")
   
-  fs.writeFileSync("output.png", minifiedGreyImageBuffer)
+  fs.writeFileSync("output.png", greyImageBuffer)
   
-  return minifiedGreyImageBuffer
+  return greyImageBuffer
 }
 
 const sendImage = async () => {
@@ -0,0 +1,118 @@
+// Host microbenchmark of StripPacker against the former per-pixel index arithmetic of App::drawPixel.
+//
+// g++ -O2 -std=c++20 -I../main strip_packer_benchmark.cpp -o strip_packer_benchmark && ./strip_packer_benchmark
+
+#include "strip_packer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+constexpr std::size_t bufferSize = 30000; // pixel buffer of the display driver
+constexpr int repetitions = 15;
+
+struct Result {
+  std::vector<uint8_t> packed;
+  double nsPerPixel;
+};
+
+// flushed strips are appended to packed output, so both packers can be compared byte by byte
+template<typename Pack>
+Result measure(uint32_t width, uint32_t height, Pack&& pack) {
+  std::vector<double> times;
+  std::vector<uint8_t> packed;
+  for (int i = 0; i < repetitions; i++) {
+    packed.clear();
+    const auto start = std::chrono::steady_clock::now();
+    pack(packed);
+    const auto end = std::chrono::steady_clock::now();
+    times.push_back(std::chrono::duration<double, std::nano>(end - start).count() / (width * height));
+  }
+  std::sort(times.begin(), times.end());
+  return {packed, times[times.size() / 2]};
+}
+
+// App::drawPixel before StripPacker
+Result measureIndexed(uint32_t width, uint32_t height, const std::vector<uint8_t>& levels) {
+  return measure(width, height, [&](std::vector<uint8_t>& packed) {
+    std::vector<uint8_t> buffer(bufferSize);
+    const uint32_t rowSize = width / 2;
+    const uint32_t stripCapacity = bufferSize / rowSize * rowSize;
+    uint32_t currentBufferOffset = 0;
+    const auto flush = [&]() {
+      const uint32_t y = currentBufferOffset / rowSize;
+      const uint32_t rows = std::min(stripCapacity / rowSize, height - y);
+      packed.insert(packed.end(), buffer.begin(), buffer.begin() + rows * rowSize);
+    };
+
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) {
+        const uint32_t pixelIndex = y * width + x;
+        uint32_t bufferIndex = pixelIndex / 2 - currentBufferOffset;
+        if (bufferIndex >= stripCapacity) {
+          flush();
+          currentBufferOffset += stripCapacity;
+          bufferIndex = pixelIndex / 2 - currentBufferOffset;
+        }
+
+        const uint8_t level = levels[pixelIndex];
+        if ((pixelIndex % 2) == 0) {
+          buffer[bufferIndex] = level << 4;
+        } else {
+          buffer[bufferIndex] |= level;
+        }
+        if (pixelIndex == width * height - 1) flush();
+      }
+    }
+  });
+}
+
+Result measurePacker(uint32_t width, uint32_t height, const std::vector<uint8_t>& levels) {
+  return measure(width, height, [&](std::vector<uint8_t>& packed) {
+    std::vector<uint8_t> buffer(bufferSize);
+    const uint32_t rowSize = StripPacker<4>::rowSize(width);
+    StripPacker<4> packer{buffer.data(), buffer.size(), [&](uint32_t, uint32_t rows) {
+                            packed.insert(packed.end(), buffer.begin(), buffer.begin() + rows * rowSize);
+                          }};
+
+    packer.begin(width, height);
+    for (uint32_t y = 0; y < height; y++) {
+      for (uint32_t x = 0; x < width; x++) packer.push(levels[y * width + x]);
+    }
+  });
+}
+
+int main() {
+  struct Size {
+    uint32_t width;
+    uint32_t height;
+  };
+  constexpr Size sizes[] = {{1200, 825}, {600, 400}, {200, 48}};
+
+  std::mt19937 random{42};
+  bool isMatching = true;
+  std::printf("%-10s %16s %16s %8s\n", "image", "indexed ns/px", "packer ns/px", "speedup");
+  for (const auto& size : sizes) {
+    std::vector<uint8_t> levels(size.width * size.height);
+    for (auto& level : levels) level = random() & 0x0f;
+
+    const auto indexed = measureIndexed(size.width, size.height, levels);
+    const auto packer = measurePacker(size.width, size.height, levels);
+    isMatching = isMatching && indexed.packed == packer.packed;
+
+    char name[16];
+    std::snprintf(name, sizeof(name), "%ux%u", size.width, size.height);
+    std::printf("%-10s %16.3f %16.3f %7.2fx\n",
+      name,
+      indexed.nsPerPixel,
+      packer.nsPerPixel,
+      indexed.nsPerPixel / packer.nsPerPixel);
+  }
+
+  std::printf("packed output %s\n", isMatching ? "matches" : "DIFFERS");
+  return isMatching ? 0 : 1;
+}
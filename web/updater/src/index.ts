@@ -1,29 +1,45 @@
-import mqtt from "async-mqtt"
-import imagemin from "imagemin"
+import mqtt, { AsyncMqttClient } from "async-mqtt"
 import puppeteer, { Browser, Page } from "puppeteer"
-import imageminPngquant from "imagemin-pngquant"
 import Jimp from "jimp"
 import fs from "fs/promises"
+import { createHash } from "crypto"
+import { withOffsetChunk, withTextChunk } from "./pngChunks.js"
+
+const width = 1200
+const height = 825
+
+// "jpeg" publishes full page as baseline JPEG (much smaller for photos), regions are always PNG (they need oFFs chunk)
+const imageFormat = process.env.IMAGE_FORMAT ?? "png"
+const jpegQuality = Number(process.env.JPEG_QUALITY ?? "85")
+
+// widgets of display page (class names) published as separate regions, eg. "clock,weather,currency,calendar,image"
+const regionNames = (process.env.REGIONS ?? "").split(",").filter(name => name.length > 0)
+
+type Region = {
+  name: string
+  x: number
+  y: number
+  width: number
+  height: number
+}
 
 let browser: Browser | null = null
 let page: Page | null = null
 
-const captureBlackWhiteImage = async (url: string): Promise<Buffer> => {
+const lastRegionImages = new Map<string, Buffer>()
+
+const capturePage = async (url: string): Promise<Buffer> => {
   console.log("Capturing website screenshot...")
 
-  console.time("image")
   console.time("capture")
 
-  const width = 1200
-  const height = 825
-
   if (!browser)
     browser = await puppeteer.launch()
   if (!page) {
     page = await browser.newPage()
     await page.setViewport({
-      width: 1200,
-      height: 825,
+      width,
+      height,
       deviceScaleFactor: 0,
     })
     page
@@ -35,7 +51,7 @@ const captureBlackWhiteImage = async (url: string): Promise<Buffer> => {
   await page.goto(url, {
     waitUntil: "networkidle2"
   })
-  
+
   const imageBuffer = Buffer.from(await page.screenshot({
     type: "png",
     clip: {
@@ -45,33 +61,43 @@ const captureBlackWhiteImage = async (url: string): Promise<Buffer> => {
 
   console.timeEnd("capture")
 
-  const img = await Jimp.read(imageBuffer)
-  img
-    .greyscale()
-    .contrast(0.1)
-    .normalize()
-
-  const greyImageBuffer = await img.getBufferAsync(Jimp.MIME_PNG)
-  const minifiedGreyImageBuffer = await imagemin.buffer(
-    greyImageBuffer, {
-    plugins: [
-      imageminPngquant({
-        // TODO play with these params and get feedback from display (look and change, maximize quality)
-        quality: [0.0, 1.0],
-        strip: true,
-        posterize: 4,
-        dithering: false,
-      })
-    ]
-  })
-  console.timeEnd("image")
+  return imageBuffer
+}
+
+// display uploads 4bpp pixels in 16 bit words, so region x and width are aligned to 4 pixels
+const findRegions = async (): Promise<Region[]> => {
+  const regions: Region[] = []
+  for (const name of regionNames) {
+    const box = await page?.$eval(`.${name}`, element => {
+      const { x, y, width, height } = element.getBoundingClientRect()
+      return { x, y, width, height }
+    })
+    if (!box) throw new Error(`Region '${name}' not found on the page`)
 
-  await fs.writeFile("image.png", minifiedGreyImageBuffer)
+    const x = Math.max(0, Math.floor(box.x / 4) * 4)
+    const right = Math.min(width, Math.ceil((box.x + box.width) / 4) * 4)
+    const y = Math.max(0, Math.floor(box.y))
+    const bottom = Math.min(height, Math.ceil(box.y + box.height))
+    regions.push({ name, x, y, width: right - x, height: bottom - y })
+  }
+  return regions
+}
+
+// smooth 8 bit greyscale deflates well, contrast (tone curve) and dithering is done by the display
+const toDisplayImage = async (img: Jimp): Promise<Buffer> => {
+  img.greyscale()
+  img.colorType(0)
+  return withTextChunk(await img.getBufferAsync(Jimp.MIME_PNG), "dither", "floyd-steinberg")
+}
 
-  return minifiedGreyImageBuffer
+// display decodes JPEG by ESP32 ROM decoder which supports only YCbCr JPEG, so grey image is encoded in 3 components
+const toDisplayJpeg = async (img: Jimp): Promise<Buffer> => {
+  img.greyscale()
+  img.quality(jpegQuality)
+  return img.getBufferAsync(Jimp.MIME_JPEG)
 }
 
-const sendImage = async (image: Buffer) => {
+const connect = async (): Promise<AsyncMqttClient> => {
   console.log("Connecting to MQTT...")
   const client = await mqtt.connectAsync(process.env.MQTT_URL ?? "", {
     username: process.env.MQTT_USER ?? "",
@@ -81,16 +107,62 @@ const sendImage = async (image: Buffer) => {
   if (!client.connected || client.disconnected) throw new Error("Could not connect to MQTT server")
 
   console.log("MQTT connected!")
+  return client
+}
+
+// short content hash, display downloads the image only when it differs from the version it shows
+const contentVersion = (image: Buffer) => createHash("sha1").update(image).digest("hex").slice(0, 16)
 
-  const topic = process.env.MQTT_TOPIC ?? ""
+const publish = async (client: AsyncMqttClient, topic: string, image: Buffer) => {
   console.log(`Publishing image ${image.byteLength / 1024} kB on topic '${topic}'`)
 
   console.time("publish")
 
   await client.publish(topic, image, { retain: true })
+  // NOTE version goes after the image, display which sees new version subscribes the image and gets the new one
+  await client.publish(`${topic}/version`, contentVersion(image), { retain: true })
 
   console.timeEnd("publish")
+}
 
+const sendImage = async (screenshot: Buffer) => {
+  console.time("image")
+  const isJpeg = imageFormat === "jpeg"
+  const screenshotImage = await Jimp.read(screenshot)
+  const image = isJpeg ? await toDisplayJpeg(screenshotImage) : await toDisplayImage(screenshotImage)
+  console.timeEnd("image")
+
+  await fs.writeFile(isJpeg ? "image.jpg" : "image.png", image)
+
+  const client = await connect()
+  await publish(client, process.env.MQTT_TOPIC ?? "", image)
+  await client.end()
+}
+
+// only regions which changed since last update are published (retained), display redraws only those
+const sendRegions = async (screenshot: Buffer) => {
+  const regions = await findRegions()
+  const fullImage = await Jimp.read(screenshot)
+
+  const changedRegions: [Region, Buffer][] = []
+  for (const region of regions) {
+    const crop = fullImage.clone().crop(region.x, region.y, region.width, region.height)
+    const image = withOffsetChunk(await toDisplayImage(crop), region.x, region.y)
+
+    if (lastRegionImages.get(region.name)?.equals(image)) continue
+    changedRegions.push([region, image])
+  }
+
+  if (changedRegions.length === 0) {
+    console.log("No region has changed")
+    return
+  }
+
+  const client = await connect()
+  for (const [region, image] of changedRegions) {
+    await publish(client, `${process.env.MQTT_TOPIC ?? ""}/region/${region.name}`, image)
+    lastRegionImages.set(region.name, image)
+  }
   await client.end()
 }
 
@@ -99,8 +171,12 @@ async function run() {
   while (true) {
     const url = `${process.env.WWW_URL}/display`
     console.log(`Making screenshot of '${url}'`);
-    const image = await captureBlackWhiteImage(url)
-    await sendImage(image)
+    const screenshot = await capturePage(url)
+    if (regionNames.length > 0) {
+      await sendRegions(screenshot)
+    } else {
+      await sendImage(screenshot)
+    }
     const memoryData = process.memoryUsage()
     console.log(`Heap used: ${memoryData.heapUsed}`)
     await new Promise(resolve => setTimeout(resolve, sendImageInterval))